@@ -8,6 +8,7 @@ package org.jetbrains.kotlin.backend.konan
 import llvm.*
 import org.jetbrains.kotlin.backend.konan.ir.KonanSymbols
 import org.jetbrains.kotlin.backend.konan.llvm.*
+import org.jetbrains.kotlin.cli.common.messages.CompilerMessageSeverity
 import org.jetbrains.kotlin.descriptors.Modality
 import org.jetbrains.kotlin.descriptors.DescriptorVisibilities
 import org.jetbrains.kotlin.ir.declarations.*
@@ -171,6 +172,10 @@ internal fun initializeCachedBoxes(context: Context) {
             val rangeEnd = "${cache.name}_RANGE_TO"
             initCache(cache, context, cacheName, rangeStart, rangeEnd)
         }
+    } else if (context.config.boxCacheRange != null && context.config.produce.isFinalBinary) {
+        // Caches are placed into the module with stdlib, so they were already built with its compiler cache.
+        context.config.configuration.report(CompilerMessageSeverity.STRONG_WARNING,
+                "`-Xbox-cache-range` is ignored, as stdlib is taken from a compiler cache")
     }
 }
 
@@ -184,7 +189,7 @@ private fun initCache(cache: BoxCache, context: Context, cacheName: String,
     val staticData = context.llvm.staticData
     val llvmType = staticData.getLLVMType(kotlinType.defaultType)
 
-    val (start, end) = context.config.target.getBoxCacheRange(cache)
+    val (start, end) = context.config.getBoxCacheRange(cache)
     // Constancy of these globals allows LLVM's constant propagation and DCE
     // to remove fast path of boxing function in case of empty range.
     staticData.placeGlobal(rangeStartName, createConstant(llvmType, start), true)
@@ -213,9 +218,27 @@ private val BoxCache.defaultRange get() = when (this) {
     BoxCache.LONG -> (-128 to 127)
 }
 
-private fun KonanTarget.getBoxCacheRange(cache: BoxCache): Pair<Int, Int> = when (this) {
-    is KonanTarget.ZEPHYR   -> emptyRange
-    else                    -> cache.defaultRange
+// -Xbox-cache-range widens caches of the types where values beyond a byte are common,
+// clamped to the type bounds. It never shrinks the default range.
+private fun BoxCache.customRange(range: IntRange): Pair<Int, Int> {
+    val (defaultStart, defaultEnd) = defaultRange
+    val (minValue, maxValue) = when (this) {
+        BoxCache.BOOLEAN, BoxCache.BYTE -> return defaultRange
+        BoxCache.SHORT -> Short.MIN_VALUE.toInt() to Short.MAX_VALUE.toInt()
+        BoxCache.CHAR -> Char.MIN_VALUE.toInt() to Char.MAX_VALUE.toInt()
+        BoxCache.INT, BoxCache.LONG -> Int.MIN_VALUE to Int.MAX_VALUE
+    }
+    return minOf(range.first, defaultStart).coerceAtLeast(minValue) to
+            maxOf(range.last, defaultEnd).coerceAtMost(maxValue)
+}
+
+private fun KonanConfig.getBoxCacheRange(cache: BoxCache): Pair<Int, Int> {
+    val customRange = boxCacheRange
+    return when {
+        target is KonanTarget.ZEPHYR -> emptyRange
+        customRange != null -> cache.customRange(customRange)
+        else -> cache.defaultRange
+    }
 }
 
 internal fun IrBuiltIns.getKotlinClass(cache: BoxCache): IrClass = when (cache) {
@@ -46,6 +46,9 @@ class KonanConfig(val project: Project, val configuration: CompilerConfiguration
 
     val memoryModel: MemoryModel get() = configuration.get(KonanConfigKeys.MEMORY_MODEL)!!
     val destroyRuntimeMode: DestroyRuntimeMode get() = configuration.get(KonanConfigKeys.DESTROY_RUNTIME_MODE)!!
+    val boxCacheRange: IntRange? get() = configuration.get(KonanConfigKeys.BOX_CACHE_RANGE)
+    val elideLeafFrames: Boolean get() = configuration.getBoolean(KonanConfigKeys.ELIDE_LEAF_FRAMES)
+    val conservativeStackScanning: Boolean get() = configuration.getBoolean(KonanConfigKeys.CONSERVATIVE_STACK_SCANNING)
 
     val needVerifyIr: Boolean
         get() = configuration.get(KonanConfigKeys.VERIFY_IR) == true
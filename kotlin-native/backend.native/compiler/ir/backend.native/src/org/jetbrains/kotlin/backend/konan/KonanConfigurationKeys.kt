@@ -148,8 +148,14 @@ class KonanConfigKeys {
                 = CompilerConfigurationKey.create("perform compiler caches pre-link")
         val OVERRIDE_KONAN_PROPERTIES: CompilerConfigurationKey<Map<String, String>>
                 = CompilerConfigurationKey.create("override konan.properties values")
+        val BOX_CACHE_RANGE: CompilerConfigurationKey<IntRange>
+                = CompilerConfigurationKey.create("range of values with preallocated boxes")
         val DESTROY_RUNTIME_MODE: CompilerConfigurationKey<DestroyRuntimeMode>
                 = CompilerConfigurationKey.create("when to destroy runtime")
+        val ELIDE_LEAF_FRAMES: CompilerConfigurationKey<Boolean>
+                = CompilerConfigurationKey.create("don't register frames of functions without safe points")
+        val CONSERVATIVE_STACK_SCANNING: CompilerConfigurationKey<Boolean>
+                = CompilerConfigurationKey.create("scan stacks conservatively instead of registering frames")
     }
 }
 
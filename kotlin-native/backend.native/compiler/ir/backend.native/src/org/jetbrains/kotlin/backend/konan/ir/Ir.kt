@@ -320,6 +320,36 @@ internal class KonanSymbols(
                 } ?: error(descriptor.toString())
         return symbolTable.referenceSimpleFunction(functionDescriptor)
     }
+
+    // `indexOf` and `lastIndexOf` of these arrays are common code. Calls to them are redirected to runtime
+    // intrinsics from kotlin/collections/ArrayUtil.kt by [PostInlineLowering].
+    val arraySearchIntrinsics = listOf(byteArray, charArray, intArray, longArray).flatMap { array ->
+        listOf("indexOf" to "arrayIndexOf", "lastIndexOf" to "arrayLastIndexOf").map { (name, intrinsicName) ->
+            findArraySearch(array.descriptor, name) to findArraySearchIntrinsic(array.descriptor, intrinsicName)
+        }
+    }.toMap()
+
+    private fun findArraySearch(descriptor: ClassDescriptor, name: String): IrSimpleFunctionSymbol {
+        val functionDescriptor = kotlinCollectionsPackageScope
+                .getContributedFunctions(Name.identifier(name), NoLookupLocation.FROM_BACKEND)
+                .singleOrNull {
+                    it.valueParameters.size == 1
+                            && it.extensionReceiverParameter?.type?.constructor?.declarationDescriptor == descriptor
+                            && !it.isExpect
+                } ?: error(descriptor.toString())
+        return symbolTable.referenceSimpleFunction(functionDescriptor)
+    }
+
+    private fun findArraySearchIntrinsic(descriptor: ClassDescriptor, name: String): IrSimpleFunctionSymbol {
+        val functionDescriptor = kotlinCollectionsPackageScope
+                .getContributedFunctions(Name.identifier(name), NoLookupLocation.FROM_BACKEND)
+                .singleOrNull {
+                    it.extensionReceiverParameter == null
+                            && it.valueParameters.firstOrNull()?.type?.constructor?.declarationDescriptor == descriptor
+                } ?: error(descriptor.toString())
+        return symbolTable.referenceSimpleFunction(functionDescriptor)
+    }
+
     override val copyRangeTo get() = TODO()
 
     fun getNoParamFunction(name: Name, receiverType: KotlinType): IrFunctionSymbol {
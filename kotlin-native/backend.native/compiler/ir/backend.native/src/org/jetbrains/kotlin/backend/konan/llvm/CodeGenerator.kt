@@ -363,6 +363,9 @@ internal class FunctionGenerationContext(val function: LLVMValueRef,
             (LLVMStoreSizeOfType(llvmTargetData, runtime.frameOverlayType) / runtime.pointerSize).toInt()
     private var slotCount = frameOverlaySlotCount
     private var localAllocs = 0
+    // Whether the function calls anything which may reach a safe point, and so needs its frame to be registered.
+    private var mayReachSafePoint = false
+    private var frameElided = false
     // TODO: remove if exactly unused.
     //private var arenaSlot: LLVMValueRef? = null
     private val slotToVariableLocation = mutableMapOf<Int, VariableDebugLocation>()
@@ -563,6 +566,9 @@ internal class FunctionGenerationContext(val function: LLVMValueRef,
 
     private fun callRaw(llvmFunction: LLVMValueRef, args: List<LLVMValueRef>,
                         exceptionHandler: ExceptionHandler): LLVMValueRef {
+        if (!mayReachSafePoint && !isSafePointFree(llvmFunction)) {
+            mayReachSafePoint = true
+        }
         val rargs = args.toCValues()
         if (LLVMIsAFunction(llvmFunction) != null /* the function declaration */ &&
                 isFunctionNoUnwind(llvmFunction)) {
@@ -593,6 +599,10 @@ internal class FunctionGenerationContext(val function: LLVMValueRef,
         }
     }
 
+    private fun isSafePointFree(llvmFunction: LLVMValueRef) =
+            llvmFunction in context.llvm.safePointFreeFunctions ||
+                    (LLVMIsAFunction(llvmFunction) != null && llvmFunction.name!!.startsWith("llvm."))
+
     //-------------------------------------------------------------------------//
 
     fun phi(type: LLVMTypeRef, name: String = ""): LLVMValueRef {
@@ -1257,6 +1267,11 @@ internal class FunctionGenerationContext(val function: LLVMValueRef,
     }
 
     internal fun epilogue() {
+        // Other threads only scan this frame while this thread is at a safe point, so it may stay unregistered if
+        // the function never gets to one. Exceptions thrown from the runtime do reach safe points, but the frame's
+        // slots are dead by then. With conservative stack scanning no frames are registered at all.
+        frameElided = context.memoryModel == MemoryModel.EXPERIMENTAL &&
+                (context.config.conservativeStackScanning || context.config.elideLeafFrames && !mayReachSafePoint)
         appendingTo(prologueBb) {
             if (needsRuntimeInit) {
                 check(!forbidRuntime) { "Attempt to init runtime where runtime usage is forbidden" }
@@ -1274,7 +1289,8 @@ internal class FunctionGenerationContext(val function: LLVMValueRef,
                         listOf(slotsMem, Int8(0).llvm,
                                 Int32(slotCount * codegen.runtime.pointerSize).llvm,
                                 Int1(0).llvm))
-                call(context.llvm.enterFrameFunction, listOf(slots, Int32(vars.skipSlots).llvm, Int32(slotCount).llvm))
+                if (!frameElided)
+                    call(context.llvm.enterFrameFunction, listOf(slots, Int32(vars.skipSlots).llvm, Int32(slotCount).llvm))
             }
             addPhiIncoming(slotsPhi!!, prologueBb to slots)
             memScoped {
@@ -1491,7 +1507,7 @@ internal class FunctionGenerationContext(val function: LLVMValueRef,
 
 
     private fun releaseVars() {
-        if (needSlots) {
+        if (needSlots && !frameElided) {
             check(!forbidRuntime) { "Attempt to leave a frame where runtime usage is forbidden" }
             call(context.llvm.leaveFrameFunction,
                     listOf(slotsPhi!!, Int32(vars.skipSlots).llvm, Int32(slotCount).llvm))
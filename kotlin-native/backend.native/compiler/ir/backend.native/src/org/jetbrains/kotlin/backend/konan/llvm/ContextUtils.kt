@@ -478,6 +478,13 @@ internal class Llvm(val context: Context, val llvmModule: LLVMModuleRef) {
     val checkGlobalsAccessible = importRtFunction("CheckGlobalsAccessible")
     val Kotlin_getExceptionObject = importRtFunction("Kotlin_getExceptionObject")
 
+    // Runtime functions which never reach a safe point in the experimental MM (except by throwing an exception).
+    val safePointFreeFunctions = setOf(
+            updateHeapRefFunction, updateStackRefFunction, updateReturnRefFunction, zeroHeapRefFunction,
+            zeroArrayRefsFunction, lookupOpenMethodFunction, lookupInterfaceTableRecord, isInstanceFunction,
+            isInstanceOfClassFastFunction
+    )
+
     val kRefSharedHolderInitLocal = importRtFunction("KRefSharedHolder_initLocal")
     val kRefSharedHolderInit = importRtFunction("KRefSharedHolder_init")
     val kRefSharedHolderDispose = importRtFunction("KRefSharedHolder_dispose")
@@ -2431,6 +2431,9 @@ internal class CodeGeneratorVisitor(val context: Context, val lifetimes: Map<IrE
             return
 
         overrideRuntimeGlobal("Kotlin_destroyRuntimeMode", Int32(context.config.destroyRuntimeMode.value))
+        // Only the runtime of the experimental MM can scan stacks conservatively.
+        if (context.memoryModel == MemoryModel.EXPERIMENTAL)
+            overrideRuntimeGlobal("Kotlin_conservativeStackScanning", Int32(if (context.config.conservativeStackScanning) 1 else 0))
     }
 
     //-------------------------------------------------------------------------//
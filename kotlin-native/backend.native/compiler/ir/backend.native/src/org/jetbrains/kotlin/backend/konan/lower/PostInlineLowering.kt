@@ -27,6 +27,7 @@ import org.jetbrains.kotlin.ir.visitors.IrElementTransformer
  * This pass runs after inlining and performs the following additional transformations over some operations:
  *     - Convert immutableBlobOf() arguments to special IrConst.
  *     - Convert `obj::class` and `Class::class` to calls.
+ *     - Redirect `indexOf` and `lastIndexOf` of some primitive arrays to runtime intrinsics.
  */
 internal class PostInlineLowering(val context: Context) : BodyLoweringPass {
 
@@ -69,6 +70,13 @@ internal class PostInlineLowering(val context: Context) : BodyLoweringPass {
             override fun visitCall(expression: IrCall, data: IrBuilderWithScope): IrExpression {
                 expression.transformChildren(this, data)
 
+                symbols.arraySearchIntrinsics[expression.symbol]?.let { intrinsic ->
+                    return data.at(expression).irCall(intrinsic.owner).apply {
+                        putValueArgument(0, expression.extensionReceiver)
+                        putValueArgument(1, expression.getValueArgument(0))
+                    }
+                }
+
                 // Function inlining is changing function symbol at callsite
                 // and unbound symbol replacement is happening later.
                 // So we compare descriptors for now.
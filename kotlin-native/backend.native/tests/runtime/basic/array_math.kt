@@ -0,0 +1,100 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+@file:OptIn(ExperimentalStdlibApi::class)
+
+package runtime.basic.array_math
+
+import kotlin.math.*
+import kotlin.test.*
+
+@Test fun runTest() {
+    testDoubleFunctions()
+    testFloatFunctions()
+    testSpecialValues()
+    testRanges()
+    println("OK")
+}
+
+// Batch results are within 1 ulp of the exact ones, so they are within 2 ulps of the scalar ones.
+private fun assertClose(expected: Double, actual: Double, argument: Double) {
+    if (expected.isNaN()) {
+        assertTrue(actual.isNaN(), "$argument")
+    } else {
+        assertTrue(abs(expected - actual) <= 2 * expected.ulp, "$argument: $expected != $actual")
+    }
+}
+
+private fun testDoubleFunctions() {
+    val arguments = DoubleArray(1000) { (it - 500) * 0.731 }
+    val positive = DoubleArray(1000) { 1e-200 * 1.7.pow(it) }
+    val expected = listOf<(Double) -> Double>(::exp, ::sin, ::cos, ::sqrt, { it.pow(3.5) })
+    val actual = listOf<(DoubleArray) -> DoubleArray>(
+            { it.expInto(DoubleArray(it.size)) },
+            { it.sinInto(DoubleArray(it.size)) },
+            { it.cosInto(DoubleArray(it.size)) },
+            { it.sqrtInto(DoubleArray(it.size)) },
+            { it.powInto(3.5, DoubleArray(it.size)) })
+    for (i in expected.indices) {
+        val results = actual[i](arguments)
+        for (j in arguments.indices) {
+            assertClose(expected[i](arguments[j]), results[j], arguments[j])
+        }
+    }
+    val logarithms = positive.lnInto(DoubleArray(positive.size))
+    for (j in positive.indices) {
+        assertClose(ln(positive[j]), logarithms[j], positive[j])
+    }
+}
+
+private fun testFloatFunctions() {
+    val arguments = FloatArray(1000) { (it - 500) * 0.173f }
+    val results = arguments.copyOf().sinInto()
+    for (j in arguments.indices) {
+        assertTrue(abs(sin(arguments[j]) - results[j]) <= 2 * results[j].ulp, "${arguments[j]}")
+    }
+    val squares = arguments.copyOf().powInto(2f)
+    for (j in arguments.indices) {
+        assertEquals(arguments[j] * arguments[j], squares[j])
+    }
+}
+
+private fun testSpecialValues() {
+    val arguments = doubleArrayOf(0.0, -0.0, Double.NaN, Double.POSITIVE_INFINITY, Double.NEGATIVE_INFINITY,
+            Double.MIN_VALUE, -1.0, 1e300, 2e6)
+    for ((batch, scalar) in listOf<Pair<(DoubleArray) -> DoubleArray, (Double) -> Double>>(
+            { a: DoubleArray -> a.expInto(DoubleArray(a.size)) } to ::exp,
+            { a: DoubleArray -> a.lnInto(DoubleArray(a.size)) } to ::ln,
+            { a: DoubleArray -> a.sinInto(DoubleArray(a.size)) } to ::sin,
+            { a: DoubleArray -> a.cosInto(DoubleArray(a.size)) } to ::cos)) {
+        val results = batch(arguments)
+        for (j in arguments.indices) {
+            val expected = scalar(arguments[j])
+            if (expected.isInfinite() || expected == 0.0) {
+                assertEquals(expected.toRawBits(), results[j].toRawBits(), "${arguments[j]}")
+            } else {
+                assertClose(expected, results[j], arguments[j])
+            }
+        }
+    }
+}
+
+private fun testRanges() {
+    val array = DoubleArray(10) { it.toDouble() }
+    array.sqrtInto(array, 2, 0, 8)
+    val expected = doubleArrayOf(0.0, 1.0, 0.0, 1.0, sqrt(2.0), sqrt(3.0), 2.0, sqrt(5.0), sqrt(6.0), sqrt(7.0))
+    assertContentEquals(expected, array)
+    val destination = DoubleArray(3)
+    doubleArrayOf(1.0, 4.0, 9.0, 16.0).sqrtInto(destination, 1, 2, 4)
+    assertContentEquals(doubleArrayOf(0.0, 3.0, 4.0), destination)
+    assertFailsWith<IndexOutOfBoundsException> {
+        DoubleArray(4).expInto(DoubleArray(3))
+    }
+    assertFailsWith<IndexOutOfBoundsException> {
+        DoubleArray(4).expInto(startIndex = 3, endIndex = 2)
+    }
+    assertFailsWith<IndexOutOfBoundsException> {
+        FloatArray(4).cosInto(destinationOffset = 1)
+    }
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package runtime.collections.typed_array2
+
+import kotlin.test.*
+
+@Test fun runTest() {
+    testLittleEndian()
+    testBigEndian()
+    testFloatingPoint()
+    testBounds()
+    println("OK")
+}
+
+private fun testLittleEndian() {
+    val bytes = ByteArray(1 + 8 * 37)
+    val longs = LongArray(37) { it * 0x0102030405060708L - 17 }
+    bytes.setLongsAt(1, longs)
+    for (i in longs.indices) {
+        assertEquals(longs[i], bytes.getLongAt(1 + 8 * i))
+    }
+    val ints = IntArray(2 * longs.size)
+    bytes.getIntsAt(1, ints)
+    for (i in ints.indices) {
+        assertEquals(bytes.getIntAt(1 + 4 * i), ints[i])
+    }
+    val shorts = ShortArray(10)
+    bytes.getShortsAt(3, shorts, 2, 5)
+    assertEquals(0, shorts[0])
+    assertEquals(0, shorts[9])
+    for (i in 0 until 5) {
+        assertEquals(bytes.getShortAt(3 + 2 * i), shorts[2 + i])
+    }
+    val chars = CharArray(4) { 'a' + it }
+    bytes.setCharsAt(0, chars, 1, 2)
+    assertEquals('b', bytes.getCharAt(0))
+    assertEquals('c', bytes.getCharAt(2))
+}
+
+private fun testBigEndian() {
+    val bytes = ByteArray(8)
+    bytes.setIntsAt(0, intArrayOf(0x01020304, 0x05060708), bigEndian = true)
+    assertContentEquals(byteArrayOf(1, 2, 3, 4, 5, 6, 7, 8), bytes)
+    val longs = LongArray(1)
+    bytes.getLongsAt(0, longs, bigEndian = true)
+    assertEquals(0x0102030405060708L, longs[0])
+    bytes.getLongsAt(0, longs)
+    assertEquals(0x0807060504030201L, longs[0])
+    val shorts = ShortArray(4)
+    bytes.getShortsAt(0, shorts, bigEndian = true)
+    assertContentEquals(shortArrayOf(0x0102, 0x0304, 0x0506, 0x0708), shorts)
+}
+
+private fun testFloatingPoint() {
+    val doubles = doubleArrayOf(0.0, -0.0, 1.5, Double.NaN, Double.MAX_VALUE, Double.MIN_VALUE, Double.NEGATIVE_INFINITY)
+    val floats = FloatArray(doubles.size) { doubles[it].toFloat() }
+    for (bigEndian in listOf(false, true)) {
+        val bytes = ByteArray(8 * doubles.size)
+        bytes.setDoublesAt(0, doubles, bigEndian = bigEndian)
+        val decodedDoubles = DoubleArray(doubles.size)
+        bytes.getDoublesAt(0, decodedDoubles, bigEndian = bigEndian)
+        for (i in doubles.indices) {
+            assertEquals(doubles[i].toRawBits(), decodedDoubles[i].toRawBits())
+        }
+        bytes.setFloatsAt(0, floats, bigEndian = bigEndian)
+        val decodedFloats = FloatArray(floats.size)
+        bytes.getFloatsAt(0, decodedFloats, bigEndian = bigEndian)
+        for (i in floats.indices) {
+            assertEquals(floats[i].toRawBits(), decodedFloats[i].toRawBits())
+        }
+    }
+    val bytes = ByteArray(8)
+    bytes.setDoublesAt(0, doubleArrayOf(1.0))
+    assertEquals(1.0, bytes.getDoubleAt(0))
+}
+
+private fun testBounds() {
+    val bytes = ByteArray(17)
+    val ints = IntArray(5)
+    // Exactly fits.
+    bytes.getIntsAt(1, ints, 1, 4)
+    bytes.setIntsAt(1, ints, 1, 4)
+    bytes.getIntsAt(17, ints, 5, 0)
+    assertFailsWith<ArrayIndexOutOfBoundsException> {
+        bytes.getIntsAt(2, ints, 1, 4)
+    }
+    assertFailsWith<ArrayIndexOutOfBoundsException> {
+        bytes.getIntsAt(-1, ints, 0, 1)
+    }
+    assertFailsWith<ArrayIndexOutOfBoundsException> {
+        bytes.getIntsAt(0, ints, 2, 4)
+    }
+    assertFailsWith<ArrayIndexOutOfBoundsException> {
+        bytes.setIntsAt(0, ints, -1, 1)
+    }
+    assertFailsWith<ArrayIndexOutOfBoundsException> {
+        bytes.setIntsAt(0, ints, 0, -1)
+    }
+    assertFailsWith<ArrayIndexOutOfBoundsException> {
+        bytes.setLongsAt(0, LongArray(3))
+    }
+    // Byte count overflows 32 bits.
+    assertFailsWith<ArrayIndexOutOfBoundsException> {
+        bytes.getDoublesAt(0, DoubleArray(1), 0, Int.MAX_VALUE)
+    }
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+import kotlin.native.Platform
+import kotlin.test.*
+
+open class ControlFlowException : Exception()
+class ParserBacktrack : ControlFlowException()
+class DetailedException : Exception()
+
+fun main() {
+    val depth = DetailedException().getStackTrace().size
+    assertTrue(depth > 0)
+
+    Platform.maxStackTraceDepth = 1
+    assertEquals(1, DetailedException().getStackTrace().size)
+    Platform.maxStackTraceDepth = 0
+    assertEquals(0, DetailedException().getStackTrace().size)
+    assertFailsWith<IllegalArgumentException> { Platform.maxStackTraceDepth = -1 }
+    Platform.maxStackTraceDepth = Int.MAX_VALUE
+    assertEquals(depth, DetailedException().getStackTrace().size)
+
+    Platform.disableStackTraceCapture(ControlFlowException::class)
+    Platform.disableStackTraceCapture(ControlFlowException::class)
+    assertEquals(0, ControlFlowException().getStackTrace().size)
+    assertEquals(0, ParserBacktrack().getStackTrace().size)
+    assertEquals(depth, DetailedException().getStackTrace().size)
+    val caught = assertFailsWith<ParserBacktrack> { throw ParserBacktrack() }
+    assertTrue(caught.stackTraceToString().startsWith("ParserBacktrack"))
+
+    println("OK")
+}
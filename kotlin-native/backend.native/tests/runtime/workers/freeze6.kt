@@ -34,6 +34,29 @@ fun ensureNeverFrozenFailsTarget(){
     println("OK")
 }
 
+@Test
+fun freezeAfterFailureOnCycle() {
+    val noFreeze = Hi("qwert")
+    noFreeze.ensureNeverFrozen()
+
+    val first = Node(null)
+    val second = Node(first)
+    val list = mutableListOf<Any?>(second, noFreeze)
+    first.ref = list
+    assertFails { first.freeze() }
+    assertFalse(first.isFrozen)
+    assertFalse(second.isFrozen)
+
+    // A failed attempt must not leave anything behind.
+    list[1] = null
+    first.freeze()
+    assertTrue(first.isFrozen)
+    assertTrue(second.isFrozen)
+    assertTrue(list.isFrozen)
+    assertFalse(noFreeze.isFrozen)
+    println("OK")
+}
+
 fun createRef1(): FreezableAtomicReference<Any?> {
     val ref = FreezableAtomicReference<Any?>(null)
     ref.value = ref
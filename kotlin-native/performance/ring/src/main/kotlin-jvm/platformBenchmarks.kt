@@ -0,0 +1,10 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.AbstractBenchmarkEntry
+
+actual fun platformBenchmarks(): Map<String, AbstractBenchmarkEntry> = emptyMap()
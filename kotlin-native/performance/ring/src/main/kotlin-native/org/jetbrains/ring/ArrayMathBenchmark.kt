@@ -0,0 +1,63 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+@file:OptIn(ExperimentalStdlibApi::class)
+
+package org.jetbrains.ring
+
+import kotlin.math.*
+import org.jetbrains.benchmarksLauncher.Random
+
+// Element-wise math over arrays, as in signal processing and ML feature code. Each function is timed element by
+// element and in batch, the batch versions are vectorized.
+open class ArrayMathBenchmark {
+    private val size = BENCHMARK_SIZE * 10
+    private val arguments = DoubleArray(size) { Random.nextDouble(20.0) - 10.0 }
+    private val positiveArguments = DoubleArray(size) { Random.nextDouble(1000.0) + 1e-3 }
+    private val floatArguments = FloatArray(size) { arguments[it].toFloat() }
+    private val results = DoubleArray(size)
+    private val floatResults = FloatArray(size)
+
+    private inline fun map(source: DoubleArray, function: (Double) -> Double): Double {
+        for (i in source.indices) {
+            results[i] = function(source[i])
+        }
+        return results[size / 2]
+    }
+
+    //Benchmark
+    fun expLoop(): Double = map(arguments) { exp(it) }
+
+    //Benchmark
+    fun expBatch(): Double = arguments.expInto(results)[size / 2]
+
+    //Benchmark
+    fun lnLoop(): Double = map(positiveArguments) { ln(it) }
+
+    //Benchmark
+    fun lnBatch(): Double = positiveArguments.lnInto(results)[size / 2]
+
+    //Benchmark
+    fun sinLoop(): Double = map(arguments) { sin(it) }
+
+    //Benchmark
+    fun sinBatch(): Double = arguments.sinInto(results)[size / 2]
+
+    //Benchmark
+    fun cosLoop(): Double = map(arguments) { cos(it) }
+
+    //Benchmark
+    fun cosBatch(): Double = arguments.cosInto(results)[size / 2]
+
+    //Benchmark
+    fun floatSinLoop(): Float {
+        for (i in floatArguments.indices) {
+            floatResults[i] = sin(floatArguments[i])
+        }
+        return floatResults[size / 2]
+    }
+
+    //Benchmark
+    fun floatSinBatch(): Float = floatArguments.sinInto(floatResults)[size / 2]
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Random
+
+// Values up to 127 come from the default box cache, wider ones allocate unless built with -Xbox-cache-range.
+open class BoxingBenchmark {
+    private val smallIds = IntArray(BENCHMARK_SIZE) { Random.nextInt(128) }
+    private val mediumIds = IntArray(BENCHMARK_SIZE) { Random.nextInt(1024) }
+    private val mediumLongIds = LongArray(BENCHMARK_SIZE) { Random.nextInt(1024).toLong() }
+    private val chars = CharArray(BENCHMARK_SIZE) { (Random.nextInt(1024) + 32).toChar() }
+
+    //Benchmark
+    fun fillListWithSmallInts(): Int {
+        val list = ArrayList<Int>(BENCHMARK_SIZE)
+        for (id in smallIds) {
+            list.add(id)
+        }
+        return list.size
+    }
+
+    //Benchmark
+    fun fillListWithMediumInts(): Int {
+        val list = ArrayList<Int>(BENCHMARK_SIZE)
+        for (id in mediumIds) {
+            list.add(id)
+        }
+        return list.size
+    }
+
+    //Benchmark
+    fun fillListWithMediumLongs(): Int {
+        val list = ArrayList<Long>(BENCHMARK_SIZE)
+        for (id in mediumLongIds) {
+            list.add(id)
+        }
+        return list.size
+    }
+
+    //Benchmark
+    fun fillListWithChars(): Int {
+        val list = ArrayList<Char>(BENCHMARK_SIZE)
+        for (char in chars) {
+            list.add(char)
+        }
+        return list.size
+    }
+
+    //Benchmark
+    fun countMediumInts(): Int {
+        val counts = HashMap<Int, Int>()
+        for (id in mediumIds) {
+            counts[id] = (counts[id] ?: 0) + 1
+        }
+        return counts.size
+    }
+
+    //Benchmark
+    fun mapMediumInts(): Int {
+        return mediumIds.map { it + 1 }.sum()
+    }
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Random
+
+// Every benchmark moves BUFFER_BYTES bytes, so throughput in GB/s is BUFFER_BYTES / (time in ns).
+const val BUFFER_BYTES = 1 shl 20
+
+open class ByteBufferBenchmark {
+    private val bytes = ByteArray(BUFFER_BYTES) { Random.nextInt().toByte() }
+    private val ints = IntArray(BUFFER_BYTES / 4) { Random.nextInt(Int.MAX_VALUE) }
+    private val longs = LongArray(BUFFER_BYTES / 8) { Random.nextInt(Int.MAX_VALUE).toLong() shl 31 }
+    private val doubles = DoubleArray(BUFFER_BYTES / 8) { Random.nextDouble() }
+
+    //Benchmark
+    fun decodeIntsLoop(): IntArray {
+        for (i in ints.indices) {
+            ints[i] = bytes.getIntAt(4 * i)
+        }
+        return ints
+    }
+
+    //Benchmark
+    fun decodeInts(): IntArray {
+        bytes.getIntsAt(0, ints)
+        return ints
+    }
+
+    //Benchmark
+    fun decodeIntsBigEndian(): IntArray {
+        bytes.getIntsAt(0, ints, bigEndian = true)
+        return ints
+    }
+
+    //Benchmark
+    fun encodeIntsLoop(): ByteArray {
+        for (i in ints.indices) {
+            bytes.setIntAt(4 * i, ints[i])
+        }
+        return bytes
+    }
+
+    //Benchmark
+    fun encodeInts(): ByteArray {
+        bytes.setIntsAt(0, ints)
+        return bytes
+    }
+
+    //Benchmark
+    fun encodeIntsBigEndian(): ByteArray {
+        bytes.setIntsAt(0, ints, bigEndian = true)
+        return bytes
+    }
+
+    //Benchmark
+    fun decodeLongsLoop(): LongArray {
+        for (i in longs.indices) {
+            longs[i] = bytes.getLongAt(8 * i)
+        }
+        return longs
+    }
+
+    //Benchmark
+    fun decodeLongs(): LongArray {
+        bytes.getLongsAt(0, longs)
+        return longs
+    }
+
+    //Benchmark
+    fun decodeLongsBigEndian(): LongArray {
+        bytes.getLongsAt(0, longs, bigEndian = true)
+        return longs
+    }
+
+    //Benchmark
+    fun encodeLongsLoop(): ByteArray {
+        for (i in longs.indices) {
+            bytes.setLongAt(8 * i, longs[i])
+        }
+        return bytes
+    }
+
+    //Benchmark
+    fun encodeLongs(): ByteArray {
+        bytes.setLongsAt(0, longs)
+        return bytes
+    }
+
+    //Benchmark
+    fun encodeLongsBigEndian(): ByteArray {
+        bytes.setLongsAt(0, longs, bigEndian = true)
+        return bytes
+    }
+
+    //Benchmark
+    fun decodeDoublesLoop(): DoubleArray {
+        for (i in doubles.indices) {
+            doubles[i] = bytes.getDoubleAt(8 * i)
+        }
+        return doubles
+    }
+
+    //Benchmark
+    fun decodeDoubles(): DoubleArray {
+        bytes.getDoublesAt(0, doubles)
+        return doubles
+    }
+
+    //Benchmark
+    fun decodeDoublesBigEndian(): DoubleArray {
+        bytes.getDoublesAt(0, doubles, bigEndian = true)
+        return doubles
+    }
+
+    //Benchmark
+    fun encodeDoublesLoop(): ByteArray {
+        for (i in doubles.indices) {
+            bytes.setDoubleAt(8 * i, doubles[i])
+        }
+        return bytes
+    }
+
+    //Benchmark
+    fun encodeDoubles(): ByteArray {
+        bytes.setDoublesAt(0, doubles)
+        return bytes
+    }
+
+    //Benchmark
+    fun encodeDoublesBigEndian(): ByteArray {
+        bytes.setDoublesAt(0, doubles, bigEndian = true)
+        return bytes
+    }
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Random
+
+// A lexer classifies every char of its input.
+open class CharClassificationBenchmark {
+    private val asciiSource = generateSource("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_")
+    private val unicodeSource = generateSource("абвгдежзийклмнопрстуфхцчшщэюяΑΒΓΔαβγδàéîõüñçß中文字符")
+
+    private fun generateSource(letters: String) = buildString {
+        repeat(BENCHMARK_SIZE) {
+            when (Random.nextInt(4)) {
+                0 -> repeat(Random.nextInt(10) + 1) { append(letters[Random.nextInt(letters.length)]) }
+                1 -> append(Random.nextInt(Int.MAX_VALUE))
+                2 -> append("+-*/(){};,.=<>"[Random.nextInt(14)])
+                else -> append(if (Random.nextInt(8) == 0) '\n' else ' ')
+            }
+        }
+    }
+
+    private fun countTokens(source: String): Int {
+        var tokens = 0
+        var index = 0
+        while (index < source.length) {
+            val char = source[index]
+            when {
+                char.isWhitespace() -> index++
+                char.isLetter() || char == '_' -> {
+                    while (index < source.length && (source[index].isLetterOrDigit() || source[index] == '_')) index++
+                    tokens++
+                }
+                char.isDigit() -> {
+                    while (index < source.length && source[index].isDigit()) index++
+                    tokens++
+                }
+                else -> {
+                    index++
+                    tokens++
+                }
+            }
+        }
+        return tokens
+    }
+
+    //Benchmark
+    fun tokenizeAscii(): Int = countTokens(asciiSource)
+
+    //Benchmark
+    fun tokenizeUnicode(): Int = countTokens(unicodeSource)
+
+    //Benchmark
+    fun countUpperCase(): Int = unicodeSource.count { it.isUpperCase() }
+
+    //Benchmark
+    fun uppercaseChars(): Int {
+        var hash = 0
+        for (char in unicodeSource) {
+            hash = hash * 31 + char.toUpperCase().toInt()
+        }
+        return hash
+    }
+
+    //Benchmark
+    fun categories(): Int {
+        var punctuation = 0
+        for (char in asciiSource) {
+            if (char.category == CharCategory.OTHER_PUNCTUATION) punctuation++
+        }
+        return punctuation
+    }
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+@file:OptIn(ExperimentalStdlibApi::class)
+
+package org.jetbrains.ring
+
+import kotlin.native.concurrent.AtomicInt
+import kotlin.native.internal.GC
+import kotlin.native.internal.createCleaner
+import kotlin.native.internal.waitCleanerWorker
+
+private val cleanedCount = AtomicInt(0)
+
+private class Resource {
+    val cleaner = createCleaner(cleanedCount) { it.increment() }
+}
+
+// Objects with cleaners are collected and the benchmark waits for the cleaners to run: a burst of them measures the
+// throughput of the cleaner worker, a single one measures the latency.
+open class CleanerBenchmark {
+    private fun clean(count: Int): Int {
+        for (index in 0 until count) {
+            Resource()
+        }
+        GC.collect()
+        waitCleanerWorker()
+        return cleanedCount.value
+    }
+
+    //Benchmark
+    fun cleanMany(): Int = clean(10_000)
+
+    //Benchmark
+    fun cleanOne(): Int = clean(1)
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import kotlin.native.concurrent.AtomicReference
+import kotlin.native.concurrent.TransferMode
+import kotlin.native.concurrent.Worker
+import kotlin.native.concurrent.freeze
+import kotlin.native.internal.GC
+import kotlin.native.ref.WeakReference
+
+// Garbage found by the cyclic collector is only released on a rendezvous of a worker other than the main one.
+private val rendezvousWorker = Worker.start()
+
+private class GraphNode(val id: Int) {
+    val next = AtomicReference<GraphNode?>(null)
+}
+
+private fun createGarbageCycle(): WeakReference<Any> {
+    val atomic = AtomicReference<Any?>(null)
+    val holder = arrayOf<Any?>(atomic).freeze()
+    atomic.value = holder
+    return WeakReference(holder)
+}
+
+// The cyclic collector analyses a graph of frozen objects linked through atomic references, while the benchmark
+// keeps changing these references, which restarts the analysis. Measures the time it takes to find a garbage cycle
+// created before the collection was requested. Does nothing unless the runtime is built with the cyclic collector.
+open class CyclicCollectorBenchmark {
+    private val nodes = Array(10_000) { GraphNode(it) }.freeze()
+    private var mutationCount = 0
+
+    init {
+        for (node in nodes) {
+            node.next.value = nodes[(node.id * 7 + 1) % nodes.size]
+        }
+    }
+
+    private fun mutate(count: Int) {
+        repeat(count) {
+            val node = nodes[mutationCount++ % nodes.size]
+            node.next.value = nodes[(node.id + mutationCount) % nodes.size]
+        }
+    }
+
+    //Benchmark
+    fun collectUnderMutation(): Int {
+        if (!GC.cyclicCollectorEnabled) return 0
+        val garbage = createGarbageCycle()
+        // New containers hold an extra reference until the next collection, the analysis would keep them.
+        GC.collect()
+        GC.collectCyclic()
+        var rendezvousCount = 0
+        while (garbage.get() != null && rendezvousCount < 10_000) {
+            mutate(100)
+            rendezvousWorker.execute(TransferMode.SAFE, {}) {}.result
+            GC.collect()
+            rendezvousCount++
+        }
+        return rendezvousCount
+    }
+}
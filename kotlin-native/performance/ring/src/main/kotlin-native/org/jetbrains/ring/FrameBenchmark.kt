@@ -0,0 +1,46 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+private class Node(val value: Int, val left: Node?, val right: Node?)
+
+private fun buildTree(depth: Int, value: Int): Node? =
+        if (depth == 0) null else Node(value, buildTree(depth - 1, value * 2), buildTree(depth - 1, value * 2 + 1))
+
+// Every call with object references on the stack pushes and pops a shadow stack frame.
+open class FrameBenchmark {
+    private val tree = buildTree(16, 1)!!
+
+    private fun sum(node: Node?): Int {
+        if (node == null) return 0
+        return node.value + sum(node.left) + sum(node.right)
+    }
+
+    // `result` needs a frame slot, but there are neither calls nor loops here, so no safe point is reached before the
+    // epilogue, and the frame may stay unregistered with -Xelide-leaf-frames.
+    private fun leftChildOrSelf(node: Node): Node {
+        var result = node
+        val left = node.left
+        if (left != null) result = left
+        return result
+    }
+
+    //Benchmark
+    fun recursiveCalls(): Int = sum(tree)
+
+    //Benchmark
+    fun leafCalls(): Int {
+        var result = 0
+        var node: Node? = tree
+        while (node != null) {
+            for (i in 0 until 1000) {
+                result += leftChildOrSelf(node).value
+            }
+            node = node.right
+        }
+        return result
+    }
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import kotlin.native.concurrent.freeze
+
+private class ConfigNode(val id: Int) {
+    var left: ConfigNode? = null
+    var right: ConfigNode? = null
+    var parent: ConfigNode? = null
+}
+
+// Every benchmark builds a fresh graph, as a frozen one can't be frozen again: a complete binary tree, where nodes
+// of cyclic graphs also refer to their parents.
+open class FreezeBenchmark {
+    private fun buildGraph(size: Int, cyclic: Boolean): ConfigNode {
+        val nodes = Array(size) { ConfigNode(it) }
+        for (index in 1 until size) {
+            val parent = nodes[(index - 1) / 2]
+            if (index % 2 == 1) parent.left = nodes[index] else parent.right = nodes[index]
+            if (cyclic) nodes[index].parent = parent
+        }
+        return nodes[0]
+    }
+
+    private fun freezeGraph(size: Int, cyclic: Boolean): Int = buildGraph(size, cyclic).freeze().id
+
+    //Benchmark
+    fun freezeTree1K(): Int = freezeGraph(1_000, false)
+
+    //Benchmark
+    fun freezeCyclic1K(): Int = freezeGraph(1_000, true)
+
+    //Benchmark
+    fun freezeTree1M(): Int = freezeGraph(1_000_000, false)
+
+    //Benchmark
+    fun freezeCyclic1M(): Int = freezeGraph(1_000_000, true)
+}
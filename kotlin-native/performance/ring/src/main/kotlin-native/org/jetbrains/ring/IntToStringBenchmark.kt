@@ -0,0 +1,79 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Random
+
+open class IntToStringBenchmark {
+    // Mostly small numbers, as counters and identifiers are.
+    private val ints = IntArray(BENCHMARK_SIZE) { Random.nextInt(Int.MAX_VALUE) shr Random.nextInt(31) }
+    private val longs = LongArray(BENCHMARK_SIZE) {
+        (Random.nextInt(Int.MAX_VALUE).toLong() shl 32 or Random.nextInt(Int.MAX_VALUE).toLong()) shr Random.nextInt(63)
+    }
+
+    //Benchmark
+    fun intToString(): Int {
+        var length = 0
+        for (value in ints) {
+            length += value.toString().length
+        }
+        return length
+    }
+
+    //Benchmark
+    fun negativeIntToString(): Int {
+        var length = 0
+        for (value in ints) {
+            length += (-value).toString().length
+        }
+        return length
+    }
+
+    //Benchmark
+    fun longToString(): Int {
+        var length = 0
+        for (value in longs) {
+            length += value.toString().length
+        }
+        return length
+    }
+
+    //Benchmark
+    fun intToHexString(): Int {
+        var length = 0
+        for (value in ints) {
+            length += value.toString(16).length
+        }
+        return length
+    }
+
+    //Benchmark
+    fun longToRadix36String(): Int {
+        var length = 0
+        for (value in longs) {
+            length += value.toString(36).length
+        }
+        return length
+    }
+
+    //Benchmark
+    fun appendInts(): Int {
+        val builder = StringBuilder()
+        for (value in ints) {
+            builder.append(value).append(',')
+        }
+        return builder.length
+    }
+
+    //Benchmark
+    fun appendLongs(): Int {
+        val builder = StringBuilder()
+        for (value in longs) {
+            builder.append(value).append(',')
+        }
+        return builder.length
+    }
+}
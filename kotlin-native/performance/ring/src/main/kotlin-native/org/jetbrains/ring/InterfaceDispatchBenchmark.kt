@@ -0,0 +1,108 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Random
+
+private interface Shape {
+    fun area(): Int
+}
+
+private interface Named {
+    fun nameLength(): Int
+}
+
+private interface Weighted {
+    fun weight(): Int
+}
+
+private interface Colored {
+    fun color(): Int
+}
+
+private interface Visitable {
+    fun accept(visitor: Int): Int
+}
+
+private interface Versioned {
+    fun version(): Int
+}
+
+private interface Tagged {
+    fun tag(): Int
+}
+
+private interface Ranked {
+    fun rank(): Int
+}
+
+private abstract class Element(val seed: Int) : Shape, Named, Weighted, Colored, Visitable, Versioned, Tagged, Ranked {
+    override fun nameLength() = seed and 7
+    override fun weight() = seed shr 1
+    override fun color() = seed xor 0x55
+    override fun accept(visitor: Int) = visitor + seed
+    override fun version() = 1
+    override fun tag() = seed and 3
+    override fun rank() = seed % 10
+}
+
+private class Element0(seed: Int) : Element(seed) { override fun area() = seed }
+private class Element1(seed: Int) : Element(seed) { override fun area() = seed + 1 }
+private class Element2(seed: Int) : Element(seed) { override fun area() = seed + 2; override fun weight() = 2 }
+private class Element3(seed: Int) : Element(seed) { override fun area() = seed + 3; override fun color() = 3 }
+private class Element4(seed: Int) : Element(seed) { override fun area() = seed + 4; override fun tag() = 4 }
+private class Element5(seed: Int) : Element(seed) { override fun area() = seed + 5; override fun rank() = 5 }
+private class Element6(seed: Int) : Element(seed) { override fun area() = seed + 6; override fun version() = 6 }
+private class Element7(seed: Int) : Element(seed) { override fun area() = seed + 7; override fun nameLength() = 7 }
+
+// Calls interface methods on a mix of classes, so that every call site sees all of them.
+open class InterfaceDispatchBenchmark {
+    private val monomorphic: Array<Any> = Array(BENCHMARK_SIZE) { Element0(it) }
+    private val megamorphic: Array<Any> = Array(BENCHMARK_SIZE) {
+        when (Random.nextInt(8)) {
+            0 -> Element0(it)
+            1 -> Element1(it)
+            2 -> Element2(it)
+            3 -> Element3(it)
+            4 -> Element4(it)
+            5 -> Element5(it)
+            6 -> Element6(it)
+            else -> Element7(it)
+        }
+    }
+
+    private fun callAll(elements: Array<Any>): Int {
+        var sum = 0
+        for (element in elements) {
+            sum += (element as Shape).area()
+            sum += (element as Named).nameLength()
+            sum += (element as Weighted).weight()
+            sum += (element as Colored).color()
+            sum += (element as Visitable).accept(sum)
+            sum += (element as Versioned).version()
+            sum += (element as Tagged).tag()
+            sum += (element as Ranked).rank()
+        }
+        return sum
+    }
+
+    //Benchmark
+    fun monomorphicCalls() = callAll(monomorphic)
+
+    //Benchmark
+    fun megamorphicCalls() = callAll(megamorphic)
+
+    //Benchmark
+    fun megamorphicTypeChecks(): Int {
+        var count = 0
+        for (element in megamorphic) {
+            if (element is Shape) count++
+            if (element is Ranked) count++
+            if (element is Comparable<*>) count++
+        }
+        return count
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Random
+
+open class NumberToStringBenchmark {
+    // Typical measurements with a few digits, and values spread over the whole range of exponents.
+    private val doubles = DoubleArray(BENCHMARK_SIZE) { Random.nextDouble(100.0) }
+    private val wideDoubles = DoubleArray(BENCHMARK_SIZE) {
+        Double.fromBits(Random.nextInt(Int.MAX_VALUE).toLong() shl 32 or Random.nextInt(Int.MAX_VALUE).toLong()).let {
+            if (it.isFinite()) it else 1.0
+        }
+    }
+    private val floats = FloatArray(BENCHMARK_SIZE) { Random.nextDouble(100.0).toFloat() }
+    private val wideFloats = FloatArray(BENCHMARK_SIZE) {
+        Float.fromBits(Random.nextInt(Int.MAX_VALUE)).let { if (it.isFinite()) it else 1.0f }
+    }
+
+    //Benchmark
+    fun doubleToString(): Int {
+        var length = 0
+        for (value in doubles) {
+            length += value.toString().length
+        }
+        return length
+    }
+
+    //Benchmark
+    fun wideDoubleToString(): Int {
+        var length = 0
+        for (value in wideDoubles) {
+            length += value.toString().length
+        }
+        return length
+    }
+
+    //Benchmark
+    fun floatToString(): Int {
+        var length = 0
+        for (value in floats) {
+            length += value.toString().length
+        }
+        return length
+    }
+
+    //Benchmark
+    fun wideFloatToString(): Int {
+        var length = 0
+        for (value in wideFloats) {
+            length += value.toString().length
+        }
+        return length
+    }
+}
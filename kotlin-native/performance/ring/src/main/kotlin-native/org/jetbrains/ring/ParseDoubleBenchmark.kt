@@ -0,0 +1,50 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Random
+
+// Columns of a numeric CSV file: prices, coordinates, measurements in the scientific notation and
+// doubles printed with all their digits.
+open class ParseDoubleBenchmark {
+    private val prices = Array(BENCHMARK_SIZE) {
+        "${Random.nextInt(10000)}.${Random.nextInt(100).toString().padStart(2, '0')}"
+    }
+    private val coordinates = Array(BENCHMARK_SIZE) {
+        "${Random.nextInt(360) - 180}.${Random.nextInt(1000000).toString().padStart(6, '0')}"
+    }
+    private val scientific = Array(BENCHMARK_SIZE) {
+        "${Random.nextInt(10)}.${Random.nextInt(Int.MAX_VALUE)}e${Random.nextInt(600) - 300}"
+    }
+    private val fullPrecision = Array(BENCHMARK_SIZE) { Random.nextDouble(1.0).toString() }
+    // More than 19 significant digits need the big integer algorithm.
+    private val longDecimals = Array(BENCHMARK_SIZE) {
+        "0.${Random.nextInt(Int.MAX_VALUE)}${Random.nextInt(Int.MAX_VALUE)}${Random.nextInt(Int.MAX_VALUE)}"
+    }
+
+    private fun parseAll(column: Array<String>): Double {
+        var sum = 0.0
+        for (value in column) {
+            sum += value.toDouble()
+        }
+        return sum
+    }
+
+    //Benchmark
+    fun parsePrices() = parseAll(prices)
+
+    //Benchmark
+    fun parseCoordinates() = parseAll(coordinates)
+
+    //Benchmark
+    fun parseScientific() = parseAll(scientific)
+
+    //Benchmark
+    fun parseFullPrecision() = parseAll(fullPrecision)
+
+    //Benchmark
+    fun parseLongDecimals() = parseAll(longDecimals)
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import kotlin.native.Platform
+import org.jetbrains.benchmarksLauncher.Random
+
+const val SORT_SIZE = 1 shl 20
+
+// Every benchmark sorts a fresh copy of the same random data, the copy costs the same for all of them.
+open class PrimitiveSortBenchmark {
+    private val ints = IntArray(SORT_SIZE) { Random.nextInt(Int.MAX_VALUE) - Int.MAX_VALUE / 2 }
+    private val longs = LongArray(SORT_SIZE) { (Random.nextInt(Int.MAX_VALUE).toLong() shl 32) - Random.nextInt(Int.MAX_VALUE) }
+    private val doubles = DoubleArray(SORT_SIZE) { Random.nextDouble() - 50.0 }
+    private val floats = FloatArray(SORT_SIZE) { doubles[it].toFloat() }
+
+    private inline fun <T> parallel(block: () -> T): T {
+        Platform.isParallelArraySortingActive = true
+        try {
+            return block()
+        } finally {
+            Platform.isParallelArraySortingActive = false
+        }
+    }
+
+    //Benchmark
+    fun sortIntsQuickSort(): IntArray = ints.copyOf().also { quickSort(it, 0, it.size - 1) }
+
+    //Benchmark
+    fun sortInts(): IntArray = ints.copyOf().apply { sort() }
+
+    //Benchmark
+    fun sortIntsParallel(): IntArray = parallel { sortInts() }
+
+    //Benchmark
+    fun sortLongs(): LongArray = longs.copyOf().apply { sort() }
+
+    //Benchmark
+    fun sortLongsParallel(): LongArray = parallel { sortLongs() }
+
+    //Benchmark
+    fun sortFloats(): FloatArray = floats.copyOf().apply { sort() }
+
+    //Benchmark
+    fun sortDoubles(): DoubleArray = doubles.copyOf().apply { sort() }
+
+    //Benchmark
+    fun sortDoublesParallel(): DoubleArray = parallel { sortDoubles() }
+
+    //Benchmark
+    fun sortSmallInts(): Int {
+        var sum = 0
+        for (from in 0 until SORT_SIZE step 64) {
+            val chunk = ints.copyOfRange(from, from + 64)
+            chunk.sort()
+            sum += chunk[0]
+        }
+        return sum
+    }
+
+    // The Kotlin quick sort which was used for primitive arrays before the runtime got radix sort.
+    private fun quickSort(array: IntArray, left: Int, right: Int) {
+        var i = left
+        var j = right
+        val pivot = array[(left + right) / 2]
+        while (i <= j) {
+            while (array[i] < pivot) i++
+            while (array[j] > pivot) j--
+            if (i <= j) {
+                val tmp = array[i]
+                array[i] = array[j]
+                array[j] = tmp
+                i++
+                j--
+            }
+        }
+        if (left < i - 1) quickSort(array, left, i - 1)
+        if (i < right) quickSort(array, i, right)
+    }
+}
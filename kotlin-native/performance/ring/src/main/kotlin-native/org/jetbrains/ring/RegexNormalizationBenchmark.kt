@@ -0,0 +1,44 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Random
+
+// Canonically equivalent matching decomposes both the pattern and every char of the input.
+open class RegexNormalizationBenchmark {
+    private val accented = "àáâãäåçèéêëìíîïñòóôõöùúûüýÿ"
+    private val words = Array(BENCHMARK_SIZE) { index ->
+        val length = Random.nextInt(10) + 2
+        buildString {
+            repeat(length) {
+                append(if (index % 2 == 0) 'a' + Random.nextInt(26) else accented[Random.nextInt(accented.length)])
+            }
+        }
+    }
+    private val asciiPattern = words.filterIndexed { index, _ -> index % 2 == 0 }.joinToString("|")
+    private val accentedPattern = words.filterIndexed { index, _ -> index % 2 == 1 }.joinToString("|")
+    private val text = words.joinToString(" ")
+
+    //Benchmark
+    fun compileAsciiPattern(): Int {
+        return Regex(asciiPattern, RegexOption.CANON_EQ).pattern.length
+    }
+
+    //Benchmark
+    fun compileAccentedPattern(): Int {
+        return Regex(accentedPattern, RegexOption.CANON_EQ).pattern.length
+    }
+
+    //Benchmark
+    fun findAccentedChars(): Int {
+        return Regex("[éèêë]", RegexOption.CANON_EQ).findAll(text).count()
+    }
+
+    //Benchmark
+    fun findDecomposedWord(): Int {
+        return Regex("é", RegexOption.CANON_EQ).findAll(text).count()
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import kotlin.native.concurrent.AtomicReference
+import kotlin.native.concurrent.Future
+import kotlin.native.concurrent.TransferMode
+import kotlin.native.concurrent.Worker
+import kotlin.native.concurrent.freeze
+import kotlin.native.ref.WeakReference
+
+private const val READS_PER_WORKER = 100_000
+
+private val readWorkers = Array(32) { Worker.start() }
+
+private class CachedValue(val id: Int)
+
+private class SharedReferences(value: CachedValue) {
+    val atomic = AtomicReference(value)
+    val weak = WeakReference(value)
+}
+
+// Every worker reads the same reference, so that ideally time doesn't depend on the number of workers.
+open class SharedReadBenchmark {
+    private val value = CachedValue(42).freeze()
+    private val references = SharedReferences(value).freeze()
+
+    // Jobs of Worker.execute() can't capture anything, so each kind of reads has its own function.
+    private fun readAtomic(workers: Int): Int {
+        val futures = Array<Future<Int>>(workers) {
+            readWorkers[it].execute(TransferMode.SAFE, { references }) { shared ->
+                var sum = 0
+                repeat(READS_PER_WORKER) { sum += shared.atomic.value.id }
+                sum
+            }
+        }
+        return futures.sumOf { it.result }
+    }
+
+    private fun readWeak(workers: Int): Int {
+        val futures = Array<Future<Int>>(workers) {
+            readWorkers[it].execute(TransferMode.SAFE, { references }) { shared ->
+                var sum = 0
+                repeat(READS_PER_WORKER) { sum += shared.weak.get()?.id ?: 0 }
+                sum
+            }
+        }
+        return futures.sumOf { it.result }
+    }
+
+    //Benchmark
+    fun readAtomic1(): Int = readAtomic(1)
+
+    //Benchmark
+    fun readAtomic2(): Int = readAtomic(2)
+
+    //Benchmark
+    fun readAtomic4(): Int = readAtomic(4)
+
+    //Benchmark
+    fun readAtomic8(): Int = readAtomic(8)
+
+    //Benchmark
+    fun readAtomic16(): Int = readAtomic(16)
+
+    //Benchmark
+    fun readAtomic32(): Int = readAtomic(32)
+
+    //Benchmark
+    fun readWeak1(): Int = readWeak(1)
+
+    //Benchmark
+    fun readWeak32(): Int = readWeak(32)
+}
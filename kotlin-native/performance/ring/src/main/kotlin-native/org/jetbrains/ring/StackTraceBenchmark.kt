@@ -0,0 +1,72 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import kotlin.native.Platform
+
+private class Backtrack(val position: Int) : Exception()
+
+// Error-path logging: an exception thrown a few dozen frames deep gets its stack trace rendered.
+// Control flow: a parser backtracks by throwing exceptions that nobody looks at the stack traces of.
+open class StackTraceBenchmark {
+    init {
+        Platform.disableStackTraceCapture(Backtrack::class)
+    }
+
+    private fun throwAt(depth: Int): Nothing =
+            if (depth == 0) throw IllegalStateException("failure") else throwAt(depth - 1)
+
+    private fun catchAt(depth: Int): Throwable = try {
+        throwAt(depth)
+    } catch (e: IllegalStateException) {
+        e
+    }
+
+    private fun renderedLength(depth: Int): Int {
+        var length = 0
+        repeat(BENCHMARK_SIZE / 10) {
+            length += catchAt(depth).stackTraceToString().length
+        }
+        return length
+    }
+
+    //Benchmark
+    fun shallowStackTrace(): Int = renderedLength(5)
+
+    //Benchmark
+    fun deepStackTrace(): Int = renderedLength(50)
+
+    private fun parse(depth: Int, position: Int, backtrack: Boolean): Nothing =
+            if (depth > 0) parse(depth - 1, position, backtrack)
+            else if (backtrack) throw Backtrack(position)
+            else throw IllegalArgumentException("unexpected input at $position")
+
+    //Benchmark
+    fun throwCatch(): Int {
+        var sum = 0
+        for (i in 0 until BENCHMARK_SIZE) {
+            try {
+                parse(20, i, false)
+            } catch (e: IllegalArgumentException) {
+                sum += i
+            }
+        }
+        return sum
+    }
+
+    //Benchmark
+    fun throwCatchWithoutStackTrace(): Int {
+        var sum = 0
+        for (i in 0 until BENCHMARK_SIZE) {
+            try {
+                parse(20, i, true)
+            } catch (e: Backtrack) {
+                sum += e.position
+            }
+        }
+        return sum
+    }
+}
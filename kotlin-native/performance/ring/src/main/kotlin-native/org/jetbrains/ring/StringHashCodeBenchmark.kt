@@ -0,0 +1,59 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Random
+
+// String hashes aren't cached, so every call goes through the vectorized polynomial hash.
+// Each benchmark hashes the same number of chars split into strings of the given length.
+open class StringHashCodeBenchmark {
+    private val totalLength = 64 * 1024
+
+    private fun strings(length: Int): Array<String> = Array(totalLength / length) {
+        CharArray(length) { 'a' + Random.nextInt(26) }.concatToString()
+    }
+
+    private val strings1 = strings(1)
+    private val strings4 = strings(4)
+    private val strings16 = strings(16)
+    private val strings64 = strings(64)
+    private val strings256 = strings(256)
+    private val strings1K = strings(1024)
+    private val strings4K = strings(4 * 1024)
+    private val strings64K = strings(64 * 1024)
+
+    private fun hashAll(strings: Array<String>): Int {
+        var result = 0
+        for (string in strings) {
+            result += string.hashCode()
+        }
+        return result
+    }
+
+    //Benchmark
+    fun hashCode1() = hashAll(strings1)
+
+    //Benchmark
+    fun hashCode4() = hashAll(strings4)
+
+    //Benchmark
+    fun hashCode16() = hashAll(strings16)
+
+    //Benchmark
+    fun hashCode64() = hashAll(strings64)
+
+    //Benchmark
+    fun hashCode256() = hashAll(strings256)
+
+    //Benchmark
+    fun hashCode1K() = hashAll(strings1K)
+
+    //Benchmark
+    fun hashCode4K() = hashAll(strings4K)
+
+    //Benchmark
+    fun hashCode64K() = hashAll(strings64K)
+}
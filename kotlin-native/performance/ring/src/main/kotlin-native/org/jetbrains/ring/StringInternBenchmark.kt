@@ -0,0 +1,107 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+@file:OptIn(ExperimentalStdlibApi::class)
+
+package org.jetbrains.ring
+
+import kotlin.native.MemoryModel
+import kotlin.native.Platform
+import kotlin.native.intern
+import org.jetbrains.benchmarksLauncher.Random
+
+// Emulates a JSON parser decoding object keys out of a corpus of documents with the same schema.
+open class StringInternBenchmark {
+    private val keys = listOf("id", "name", "type", "timestamp", "value", "unit", "tags", "source",
+            "description", "createdAt", "updatedAt", "owner", "status", "priority", "parent", "children")
+    private val corpus: ByteArray
+    private val keyRanges: IntArray
+    private val decodedKeys: Array<String>
+    private val internedKeys: Array<String>
+    private val internedPatterns: Array<String>
+
+    init {
+        val json = StringBuilder()
+        val ranges = ArrayList<Int>()
+        for (document in 0 until BENCHMARK_SIZE / 10) {
+            json.append('{')
+            for (key in keys) {
+                if (Random.nextInt(4) == 0) continue
+                json.append('"')
+                // Every key is ASCII, so char offsets are byte offsets.
+                ranges.add(json.length)
+                json.append(key)
+                ranges.add(json.length)
+                json.append("\":").append(Random.nextInt()).append(',')
+            }
+            json.append("}\n")
+        }
+        corpus = json.toString().encodeToByteArray()
+        keyRanges = ranges.toIntArray()
+        decodedKeys = Array(keyRanges.size / 2) { corpus.decodeToString(keyRanges[2 * it], keyRanges[2 * it + 1]) }
+        // The experimental memory model doesn't intern strings, there this measures plain comparison.
+        val interning = Platform.memoryModel != MemoryModel.EXPERIMENTAL
+        internedKeys = Array(decodedKeys.size) { if (interning) decodedKeys[it].intern() else decodedKeys[it] }
+        internedPatterns = Array(keys.size) {
+            val pattern = keys[it].toCharArray().concatToString()
+            if (interning) pattern.intern() else pattern
+        }
+    }
+
+    private fun decodeAll(): Array<String> =
+            Array(keyRanges.size / 2) { corpus.decodeToString(keyRanges[2 * it], keyRanges[2 * it + 1]) }
+
+    // The experimental memory model doesn't intern strings, there this measures plain decoding.
+    private inline fun <T> withInterningOnDecode(block: () -> T): T {
+        if (Platform.memoryModel == MemoryModel.EXPERIMENTAL) return block()
+        Platform.isStringInterningOnDecodeActive = true
+        try {
+            return block()
+        } finally {
+            Platform.isStringInterningOnDecodeActive = false
+        }
+    }
+
+    //Benchmark
+    fun decodeKeys(): Int {
+        var length = 0
+        for (index in 0 until keyRanges.size step 2) {
+            length += corpus.decodeToString(keyRanges[index], keyRanges[index + 1]).length
+        }
+        return length
+    }
+
+    //Benchmark
+    fun decodeKeysInterned(): Int = withInterningOnDecode { decodeKeys() }
+
+    // Keeping the keys alive is where the interning saves memory: all of them share 16 instances.
+    //Benchmark
+    fun retainDecodedKeys(): Array<String> = decodeAll()
+
+    //Benchmark
+    fun retainDecodedKeysInterned(): Array<String> = withInterningOnDecode { decodeAll() }
+
+    //Benchmark
+    fun compareDecodedKeys(): Int {
+        var matches = 0
+        for (key in decodedKeys) {
+            for (pattern in keys) {
+                if (key == pattern) matches++
+            }
+        }
+        return matches
+    }
+
+    //Benchmark
+    fun compareInternedKeys(): Int {
+        var matches = 0
+        for (key in internedKeys) {
+            for (pattern in internedPatterns) {
+                if (key == pattern) matches++
+            }
+        }
+        return matches
+    }
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import kotlin.native.concurrent.TransferMode
+import kotlin.native.concurrent.Worker
+
+private val transferWorker = Worker.start()
+
+private class Message(val id: Int) {
+    val payload = IntArray(4) { it + id }
+}
+
+private class HeapNode(val id: Int) {
+    var next: HeapNode? = null
+}
+
+// Small messages are transferred from a thread with a large heap of small cycles: checking that a message has no
+// external references should not depend on the size of the heap.
+open class TransferBenchmark {
+    private val heap = Array(100_000) { HeapNode(it) }
+
+    init {
+        for (index in heap.indices) {
+            if (index % 10 != 0) heap[index].next = heap[index - 1]
+            if (index % 10 == 9) heap[index - 9].next = heap[index]
+        }
+    }
+
+    private fun transfer(count: Int): Int {
+        var sum = 0
+        for (index in 0 until count) {
+            sum += transferWorker.execute(TransferMode.SAFE, { Message(index) }) { it.payload.sum() }.result
+        }
+        return sum
+    }
+
+    //Benchmark
+    fun transferMessages(): Int = transfer(1_000)
+}
@@ -0,0 +1,32 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import kotlin.native.ref.WeakReference
+
+private class CacheEntry(val key: Int)
+
+// Every weak reference target gets its own meta object, which is allocated and freed with the target.
+open class WeakReferenceBenchmark {
+    //Benchmark
+    fun createWeakReferences(): Int {
+        var sum = 0
+        for (index in 0 until 10_000) {
+            sum += WeakReference(CacheEntry(index)).get()?.key ?: 0
+        }
+        return sum
+    }
+
+    //Benchmark
+    fun createWeakReferencesToLiveObjects(): Int {
+        val references = Array(10_000) { WeakReference(CacheEntry(it)) }
+        var sum = 0
+        for (reference in references) {
+            sum += reference.get()?.key ?: 0
+        }
+        return sum
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.*
+
+actual fun platformBenchmarks(): Map<String, AbstractBenchmarkEntry> = mapOf(
+        "StringIntern.decodeKeys" to BenchmarkEntryWithInit.create(::StringInternBenchmark, { decodeKeys() }),
+        "StringIntern.decodeKeysInterned" to BenchmarkEntryWithInit.create(::StringInternBenchmark, { decodeKeysInterned() }),
+        "StringIntern.retainDecodedKeys" to BenchmarkEntryWithInit.create(::StringInternBenchmark, { retainDecodedKeys() }),
+        "StringIntern.retainDecodedKeysInterned" to BenchmarkEntryWithInit.create(::StringInternBenchmark, { retainDecodedKeysInterned() }),
+        "StringIntern.compareDecodedKeys" to BenchmarkEntryWithInit.create(::StringInternBenchmark, { compareDecodedKeys() }),
+        "StringIntern.compareInternedKeys" to BenchmarkEntryWithInit.create(::StringInternBenchmark, { compareInternedKeys() }),
+        "StringHashCode.hashCode1" to BenchmarkEntryWithInit.create(::StringHashCodeBenchmark, { hashCode1() }),
+        "StringHashCode.hashCode4" to BenchmarkEntryWithInit.create(::StringHashCodeBenchmark, { hashCode4() }),
+        "StringHashCode.hashCode16" to BenchmarkEntryWithInit.create(::StringHashCodeBenchmark, { hashCode16() }),
+        "StringHashCode.hashCode64" to BenchmarkEntryWithInit.create(::StringHashCodeBenchmark, { hashCode64() }),
+        "StringHashCode.hashCode256" to BenchmarkEntryWithInit.create(::StringHashCodeBenchmark, { hashCode256() }),
+        "StringHashCode.hashCode1K" to BenchmarkEntryWithInit.create(::StringHashCodeBenchmark, { hashCode1K() }),
+        "StringHashCode.hashCode4K" to BenchmarkEntryWithInit.create(::StringHashCodeBenchmark, { hashCode4K() }),
+        "StringHashCode.hashCode64K" to BenchmarkEntryWithInit.create(::StringHashCodeBenchmark, { hashCode64K() }),
+        "ByteBuffer.decodeIntsLoop" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { decodeIntsLoop() }),
+        "ByteBuffer.decodeInts" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { decodeInts() }),
+        "ByteBuffer.decodeIntsBigEndian" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { decodeIntsBigEndian() }),
+        "ByteBuffer.encodeIntsLoop" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { encodeIntsLoop() }),
+        "ByteBuffer.encodeInts" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { encodeInts() }),
+        "ByteBuffer.encodeIntsBigEndian" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { encodeIntsBigEndian() }),
+        "ByteBuffer.decodeLongsLoop" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { decodeLongsLoop() }),
+        "ByteBuffer.decodeLongs" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { decodeLongs() }),
+        "ByteBuffer.decodeLongsBigEndian" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { decodeLongsBigEndian() }),
+        "ByteBuffer.encodeLongsLoop" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { encodeLongsLoop() }),
+        "ByteBuffer.encodeLongs" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { encodeLongs() }),
+        "ByteBuffer.encodeLongsBigEndian" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { encodeLongsBigEndian() }),
+        "ByteBuffer.decodeDoublesLoop" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { decodeDoublesLoop() }),
+        "ByteBuffer.decodeDoubles" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { decodeDoubles() }),
+        "ByteBuffer.decodeDoublesBigEndian" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { decodeDoublesBigEndian() }),
+        "ByteBuffer.encodeDoublesLoop" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { encodeDoublesLoop() }),
+        "ByteBuffer.encodeDoubles" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { encodeDoubles() }),
+        "ByteBuffer.encodeDoublesBigEndian" to BenchmarkEntryWithInit.create(::ByteBufferBenchmark, { encodeDoublesBigEndian() }),
+        "PrimitiveSort.sortIntsQuickSort" to BenchmarkEntryWithInit.create(::PrimitiveSortBenchmark, { sortIntsQuickSort() }),
+        "PrimitiveSort.sortInts" to BenchmarkEntryWithInit.create(::PrimitiveSortBenchmark, { sortInts() }),
+        "PrimitiveSort.sortIntsParallel" to BenchmarkEntryWithInit.create(::PrimitiveSortBenchmark, { sortIntsParallel() }),
+        "PrimitiveSort.sortLongs" to BenchmarkEntryWithInit.create(::PrimitiveSortBenchmark, { sortLongs() }),
+        "PrimitiveSort.sortLongsParallel" to BenchmarkEntryWithInit.create(::PrimitiveSortBenchmark, { sortLongsParallel() }),
+        "PrimitiveSort.sortFloats" to BenchmarkEntryWithInit.create(::PrimitiveSortBenchmark, { sortFloats() }),
+        "PrimitiveSort.sortDoubles" to BenchmarkEntryWithInit.create(::PrimitiveSortBenchmark, { sortDoubles() }),
+        "PrimitiveSort.sortDoublesParallel" to BenchmarkEntryWithInit.create(::PrimitiveSortBenchmark, { sortDoublesParallel() }),
+        "PrimitiveSort.sortSmallInts" to BenchmarkEntryWithInit.create(::PrimitiveSortBenchmark, { sortSmallInts() }),
+        "NumberToString.doubleToString" to BenchmarkEntryWithInit.create(::NumberToStringBenchmark, { doubleToString() }),
+        "NumberToString.wideDoubleToString" to BenchmarkEntryWithInit.create(::NumberToStringBenchmark, { wideDoubleToString() }),
+        "NumberToString.floatToString" to BenchmarkEntryWithInit.create(::NumberToStringBenchmark, { floatToString() }),
+        "NumberToString.wideFloatToString" to BenchmarkEntryWithInit.create(::NumberToStringBenchmark, { wideFloatToString() }),
+        "ParseDouble.parsePrices" to BenchmarkEntryWithInit.create(::ParseDoubleBenchmark, { parsePrices() }),
+        "ParseDouble.parseCoordinates" to BenchmarkEntryWithInit.create(::ParseDoubleBenchmark, { parseCoordinates() }),
+        "ParseDouble.parseScientific" to BenchmarkEntryWithInit.create(::ParseDoubleBenchmark, { parseScientific() }),
+        "ParseDouble.parseFullPrecision" to BenchmarkEntryWithInit.create(::ParseDoubleBenchmark, { parseFullPrecision() }),
+        "ParseDouble.parseLongDecimals" to BenchmarkEntryWithInit.create(::ParseDoubleBenchmark, { parseLongDecimals() }),
+        "IntToString.intToString" to BenchmarkEntryWithInit.create(::IntToStringBenchmark, { intToString() }),
+        "IntToString.negativeIntToString" to BenchmarkEntryWithInit.create(::IntToStringBenchmark, { negativeIntToString() }),
+        "IntToString.longToString" to BenchmarkEntryWithInit.create(::IntToStringBenchmark, { longToString() }),
+        "IntToString.intToHexString" to BenchmarkEntryWithInit.create(::IntToStringBenchmark, { intToHexString() }),
+        "IntToString.longToRadix36String" to BenchmarkEntryWithInit.create(::IntToStringBenchmark, { longToRadix36String() }),
+        "IntToString.appendInts" to BenchmarkEntryWithInit.create(::IntToStringBenchmark, { appendInts() }),
+        "IntToString.appendLongs" to BenchmarkEntryWithInit.create(::IntToStringBenchmark, { appendLongs() }),
+        "InterfaceDispatch.monomorphicCalls" to BenchmarkEntryWithInit.create(::InterfaceDispatchBenchmark, { monomorphicCalls() }),
+        "InterfaceDispatch.megamorphicCalls" to BenchmarkEntryWithInit.create(::InterfaceDispatchBenchmark, { megamorphicCalls() }),
+        "InterfaceDispatch.megamorphicTypeChecks" to BenchmarkEntryWithInit.create(::InterfaceDispatchBenchmark, { megamorphicTypeChecks() }),
+        "Boxing.fillListWithSmallInts" to BenchmarkEntryWithInit.create(::BoxingBenchmark, { fillListWithSmallInts() }),
+        "Boxing.fillListWithMediumInts" to BenchmarkEntryWithInit.create(::BoxingBenchmark, { fillListWithMediumInts() }),
+        "Boxing.fillListWithMediumLongs" to BenchmarkEntryWithInit.create(::BoxingBenchmark, { fillListWithMediumLongs() }),
+        "Boxing.fillListWithChars" to BenchmarkEntryWithInit.create(::BoxingBenchmark, { fillListWithChars() }),
+        "Boxing.countMediumInts" to BenchmarkEntryWithInit.create(::BoxingBenchmark, { countMediumInts() }),
+        "Boxing.mapMediumInts" to BenchmarkEntryWithInit.create(::BoxingBenchmark, { mapMediumInts() }),
+        "RegexNormalization.compileAsciiPattern" to BenchmarkEntryWithInit.create(::RegexNormalizationBenchmark, { compileAsciiPattern() }),
+        "RegexNormalization.compileAccentedPattern" to BenchmarkEntryWithInit.create(::RegexNormalizationBenchmark, { compileAccentedPattern() }),
+        "RegexNormalization.findAccentedChars" to BenchmarkEntryWithInit.create(::RegexNormalizationBenchmark, { findAccentedChars() }),
+        "RegexNormalization.findDecomposedWord" to BenchmarkEntryWithInit.create(::RegexNormalizationBenchmark, { findDecomposedWord() }),
+        "CharClassification.tokenizeAscii" to BenchmarkEntryWithInit.create(::CharClassificationBenchmark, { tokenizeAscii() }),
+        "CharClassification.tokenizeUnicode" to BenchmarkEntryWithInit.create(::CharClassificationBenchmark, { tokenizeUnicode() }),
+        "CharClassification.countUpperCase" to BenchmarkEntryWithInit.create(::CharClassificationBenchmark, { countUpperCase() }),
+        "CharClassification.uppercaseChars" to BenchmarkEntryWithInit.create(::CharClassificationBenchmark, { uppercaseChars() }),
+        "CharClassification.categories" to BenchmarkEntryWithInit.create(::CharClassificationBenchmark, { categories() }),
+        "ArrayMath.expLoop" to BenchmarkEntryWithInit.create(::ArrayMathBenchmark, { expLoop() }),
+        "ArrayMath.expBatch" to BenchmarkEntryWithInit.create(::ArrayMathBenchmark, { expBatch() }),
+        "ArrayMath.lnLoop" to BenchmarkEntryWithInit.create(::ArrayMathBenchmark, { lnLoop() }),
+        "ArrayMath.lnBatch" to BenchmarkEntryWithInit.create(::ArrayMathBenchmark, { lnBatch() }),
+        "ArrayMath.sinLoop" to BenchmarkEntryWithInit.create(::ArrayMathBenchmark, { sinLoop() }),
+        "ArrayMath.sinBatch" to BenchmarkEntryWithInit.create(::ArrayMathBenchmark, { sinBatch() }),
+        "ArrayMath.cosLoop" to BenchmarkEntryWithInit.create(::ArrayMathBenchmark, { cosLoop() }),
+        "ArrayMath.cosBatch" to BenchmarkEntryWithInit.create(::ArrayMathBenchmark, { cosBatch() }),
+        "ArrayMath.floatSinLoop" to BenchmarkEntryWithInit.create(::ArrayMathBenchmark, { floatSinLoop() }),
+        "ArrayMath.floatSinBatch" to BenchmarkEntryWithInit.create(::ArrayMathBenchmark, { floatSinBatch() }),
+        "StackTrace.shallowStackTrace" to BenchmarkEntryWithInit.create(::StackTraceBenchmark, { shallowStackTrace() }),
+        "StackTrace.deepStackTrace" to BenchmarkEntryWithInit.create(::StackTraceBenchmark, { deepStackTrace() }),
+        "StackTrace.throwCatch" to BenchmarkEntryWithInit.create(::StackTraceBenchmark, { throwCatch() }),
+        "StackTrace.throwCatchWithoutStackTrace" to BenchmarkEntryWithInit.create(::StackTraceBenchmark, { throwCatchWithoutStackTrace() }),
+        "Freeze.freezeTree1K" to BenchmarkEntryWithInit.create(::FreezeBenchmark, { freezeTree1K() }),
+        "Freeze.freezeCyclic1K" to BenchmarkEntryWithInit.create(::FreezeBenchmark, { freezeCyclic1K() }),
+        "Freeze.freezeTree1M" to BenchmarkEntryWithInit.create(::FreezeBenchmark, { freezeTree1M() }),
+        "Freeze.freezeCyclic1M" to BenchmarkEntryWithInit.create(::FreezeBenchmark, { freezeCyclic1M() }),
+        "Transfer.transferMessages" to BenchmarkEntryWithInit.create(::TransferBenchmark, { transferMessages() }),
+        "CyclicCollector.collectUnderMutation" to BenchmarkEntryWithInit.create(::CyclicCollectorBenchmark, { collectUnderMutation() }),
+        "SharedRead.readAtomic1" to BenchmarkEntryWithInit.create(::SharedReadBenchmark, { readAtomic1() }),
+        "SharedRead.readAtomic2" to BenchmarkEntryWithInit.create(::SharedReadBenchmark, { readAtomic2() }),
+        "SharedRead.readAtomic4" to BenchmarkEntryWithInit.create(::SharedReadBenchmark, { readAtomic4() }),
+        "SharedRead.readAtomic8" to BenchmarkEntryWithInit.create(::SharedReadBenchmark, { readAtomic8() }),
+        "SharedRead.readAtomic16" to BenchmarkEntryWithInit.create(::SharedReadBenchmark, { readAtomic16() }),
+        "SharedRead.readAtomic32" to BenchmarkEntryWithInit.create(::SharedReadBenchmark, { readAtomic32() }),
+        "SharedRead.readWeak1" to BenchmarkEntryWithInit.create(::SharedReadBenchmark, { readWeak1() }),
+        "SharedRead.readWeak32" to BenchmarkEntryWithInit.create(::SharedReadBenchmark, { readWeak32() }),
+        "Cleaner.cleanMany" to BenchmarkEntryWithInit.create(::CleanerBenchmark, { cleanMany() }),
+        "Cleaner.cleanOne" to BenchmarkEntryWithInit.create(::CleanerBenchmark, { cleanOne() }),
+        "WeakReference.createWeakReferences" to BenchmarkEntryWithInit.create(::WeakReferenceBenchmark, { createWeakReferences() }),
+        "WeakReference.createWeakReferencesToLiveObjects" to BenchmarkEntryWithInit.create(::WeakReferenceBenchmark, { createWeakReferencesToLiveObjects() }),
+        "Frame.recursiveCalls" to BenchmarkEntryWithInit.create(::FrameBenchmark, { recursiveCalls() }),
+        "Frame.leafCalls" to BenchmarkEntryWithInit.create(::FrameBenchmark, { leafCalls() }),
+)
@@ -213,6 +213,11 @@ class RingLauncher : Launcher() {
                     "Inheritance.baseCalls" to BenchmarkEntryWithInit.create(::InheritanceBenchmark, { baseCalls() })
             )
     )
+
+    init {
+        PrimitiveArrayBenchmark.benchmarks().forEach { (name, entry) -> add(name, entry) }
+        platformBenchmarks().forEach { (name, entry) -> add(name, entry) }
+    }
 }
 
 fun main(args: Array<String>) {
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.*
+
+// Bulk operations over primitive arrays of different sizes: from a few elements, where the call overhead dominates,
+// to arrays far larger than the caches.
+open class PrimitiveArrayBenchmark(size: Int) {
+    private val bytes = ByteArray(size) { (it % 100).toByte() }
+    private val bytesCopy = bytes.copyOf()
+    private val bytesToFill = ByteArray(size)
+    private val chars = CharArray(size) { 'a' + it % 26 }
+    private val ints = IntArray(size) { it % 1000 }
+    private val intsCopy = ints.copyOf()
+    private val intsToFill = IntArray(size)
+    private val longs = LongArray(size) { it.toLong() % 1000 }
+
+    //Benchmark
+    fun fillBytes(): ByteArray {
+        bytesToFill.fill(42)
+        return bytesToFill
+    }
+
+    //Benchmark
+    fun fillIntsWithZero(): IntArray {
+        intsToFill.fill(0)
+        return intsToFill
+    }
+
+    //Benchmark
+    fun fillInts(): IntArray {
+        intsToFill.fill(42)
+        return intsToFill
+    }
+
+    //Benchmark
+    fun contentEqualsBytes() = bytes contentEquals bytesCopy
+
+    //Benchmark
+    fun contentEqualsInts() = ints contentEquals intsCopy
+
+    // The element is absent, so the whole array is scanned.
+    //Benchmark
+    fun indexOfByte() = bytes.indexOf(-1)
+
+    //Benchmark
+    fun indexOfChar() = chars.indexOf('!')
+
+    //Benchmark
+    fun indexOfInt() = ints.indexOf(-1)
+
+    //Benchmark
+    fun lastIndexOfLong() = longs.lastIndexOf(-1)
+
+    //Benchmark
+    fun contentHashCodeInts() = ints.contentHashCode()
+
+    //Benchmark
+    fun contentHashCodeChars() = chars.contentHashCode()
+
+    companion object {
+        private val sizes = mapOf("8" to 8, "1K" to 1024, "64K" to 64 * 1024, "1M" to 1024 * 1024)
+
+        fun benchmarks(): Map<String, AbstractBenchmarkEntry> = sizes.flatMap { (name, size) ->
+            val ctor = { PrimitiveArrayBenchmark(size) }
+            listOf(
+                    "PrimitiveArray.fillBytes$name" to BenchmarkEntryWithInit.create(ctor, { fillBytes() }),
+                    "PrimitiveArray.fillIntsWithZero$name" to BenchmarkEntryWithInit.create(ctor, { fillIntsWithZero() }),
+                    "PrimitiveArray.fillInts$name" to BenchmarkEntryWithInit.create(ctor, { fillInts() }),
+                    "PrimitiveArray.contentEqualsBytes$name" to BenchmarkEntryWithInit.create(ctor, { contentEqualsBytes() }),
+                    "PrimitiveArray.contentEqualsInts$name" to BenchmarkEntryWithInit.create(ctor, { contentEqualsInts() }),
+                    "PrimitiveArray.indexOfByte$name" to BenchmarkEntryWithInit.create(ctor, { indexOfByte() }),
+                    "PrimitiveArray.indexOfChar$name" to BenchmarkEntryWithInit.create(ctor, { indexOfChar() }),
+                    "PrimitiveArray.indexOfInt$name" to BenchmarkEntryWithInit.create(ctor, { indexOfInt() }),
+                    "PrimitiveArray.lastIndexOfLong$name" to BenchmarkEntryWithInit.create(ctor, { lastIndexOfLong() }),
+                    "PrimitiveArray.contentHashCodeInts$name" to BenchmarkEntryWithInit.create(ctor, { contentHashCodeInts() }),
+                    "PrimitiveArray.contentHashCodeChars$name" to BenchmarkEntryWithInit.create(ctor, { contentHashCodeChars() })
+            )
+        }.toMap()
+    }
+}
@@ -0,0 +1,11 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.AbstractBenchmarkEntry
+
+// Benchmarks of platform-specific APIs, which have no counterpart on other platforms.
+expect fun platformBenchmarks(): Map<String, AbstractBenchmarkEntry>
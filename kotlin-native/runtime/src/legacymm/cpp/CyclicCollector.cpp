@@ -19,6 +19,7 @@
 
 #include "Alloc.h"
 #include "Atomic.h"
+#include "CyclicObjectIndex.hpp"
 #include "KAssert.h"
 #include "Memory.h"
 #include "MemoryPrivate.hpp"
@@ -63,7 +64,11 @@
  * If transitive closure of the atomic rootset mutates, it could only happen via changing the atomics references,
  * as all elements of this closure are frozen.
  * To handle such mutations we keep collector flag, which is cleared before analysis and set on every
- * atomic reference value update. If flag's value changes - collector restarts its analysis.
+ * atomic reference value update. If flag's value changes - collector restarts its analysis. As only fields of
+ * atomic references may change, the restart doesn't start from scratch: it compares fields of visited atomic
+ * references with the values counted before, recounts changed edges and only visits newly referred subgraphs.
+ * Objects which are no longer referred from an atomic reference are kept in the analysis, but are considered
+ * to have external references until the next collection.
  * There are not so much of complications in this algorithm due to the delayed reference counting as if there's a
  * stack reference to the shared object - it's reflected in the reference counter (see rememberNewContainer()).
  * We release objects found by the collector on a rendezvouz callback, but not on the main thread,
@@ -127,6 +132,27 @@ class CyclicCollector {
   KStdUnorderedSet<ObjHeader*> rootset_;
   KStdUnorderedSet<ObjHeader*> toRelease_;
 
+  // A counted reference from a field of an atomic reference.
+  struct AtomicEdge {
+    ObjHeader** location;
+    ObjHeader* value;
+  };
+
+  // Analysis state, only accessed by the collector thread under [lock_].
+  // Objects of the transitive closure of the atomic rootset.
+  CyclicObjectIndex objects_;
+  // Number of counted references from other objects of the closure, per object.
+  KStdVector<int> innerRefCounts_;
+  // Whether an object is reachable from one with external references, per object.
+  KStdVector<bool> externallyReachable_;
+  // Objects yet to be traversed, when counting inner references and when marking externally reachable objects.
+  KStdVector<uint32_t> toVisit_;
+  KStdVector<uint32_t> toMark_;
+  KStdVector<AtomicEdge> atomicEdges_;
+  // Objects no longer referred from fields of atomic references, they are treated as externally referred.
+  KStdVector<uint32_t> detached_;
+  KStdVector<ObjHeader*> candidates_;
+
  public:
   CyclicCollector() {
     CHECK_CALL(pthread_mutex_init(&lock_, nullptr), "Cannot init collector mutex");
@@ -165,148 +191,207 @@ class CyclicCollector {
     return nullptr;
   }
 
+  // Adds obj to the analysis, counting a reference to it if counted is set.
+  void addReference(ObjHeader* obj, bool counted) {
+    auto added = objects_.insert(obj);
+    if (added.second) {
+      innerRefCounts_.push_back(0);
+      toVisit_.push_back(added.first);
+    }
+    if (counted) innerRefCounts_[added.first]++;
+  }
+
+  void resetAnalysis() {
+    objects_.clear();
+    innerRefCounts_.clear();
+    toVisit_.clear();
+    atomicEdges_.clear();
+    detached_.clear();
+    for (auto* root: rootset_) {
+      // We only care about frozen values here, as only they could become part of shared cycles.
+      if (!containerFor(root)->frozen()) continue;
+      COLLECTOR_LOG("process root %p\n", root);
+      addReference(root, false);
+    }
+  }
+
+  // Recounts fields of visited atomic references which were changed since they were visited.
+  void updateMutatedEdges() {
+    for (auto& edge: atomicEdges_) {
+      ObjHeader* value = *edge.location;
+      if (value == edge.value) continue;
+      COLLECTOR_LOG("atomic field %p changed from %p to %p\n", edge.location, edge.value, value)
+      if (edge.value != nullptr) {
+        uint32_t index = objects_.find(edge.value);
+        innerRefCounts_[index]--;
+        detached_.push_back(index);
+      }
+      if (value != nullptr) addReference(value, true);
+      edge.value = value;
+    }
+  }
+
+  // Computes inner reference counts over the transitive closure. Returns false if atomics were mutated meanwhile.
+  bool countInnerReferences() {
+    while (!toVisit_.empty()) {
+      if (atomicGet(&mutatedAtomics_) != 0) {
+        COLLECTOR_LOG("restarted during rootset visit\n")
+        return false;
+      }
+      auto* obj = objects_[toVisit_.back()];
+      toVisit_.pop_back();
+      COLLECTOR_LOG("visit %s%p\n", isAtomicReference(obj) ? "atomic " : "", obj);
+      auto* objContainer = containerFor(obj);
+      if (objContainer == nullptr) continue;  // Permanent object.
+      RuntimeCheck(objContainer->shareable(), "Must be shareable");
+      bool isAtomic = isAtomicReference(obj);
+      traverseObjectFields(obj, [this, obj, objContainer, isAtomic](ObjHeader** location) {
+        ObjHeader* ref = *location;
+        // Remember fields of atomic references, even empty ones, to find out which of them were changed.
+        if (isAtomic) atomicEdges_.push_back({location, ref});
+        if (ref == nullptr) return;
+        COLLECTOR_LOG("object field %p in %p\n", ref, obj)
+        // We shall not account for edges inside the same frozen container, unless it originates
+        // from an atomic reference.
+        bool counted = isAtomic || objContainer != containerFor(ref);
+        COLLECTOR_LOG("%s %p -> %p\n", counted ? "counting" : "not counting", obj, ref)
+        addReference(ref, counted);
+      });
+    }
+    return true;
+  }
+
+  int innerRefCount(ObjHeader* obj) {
+    uint32_t index = objects_.find(obj);
+    return index == CyclicObjectIndex::kNotFound ? 0 : innerRefCounts_[index];
+  }
+
+  // Finds all elements with external references, and marks objects reachable from them as non suitable
+  // for collection. Returns false if atomics were mutated meanwhile.
+  bool markExternallyReachable() {
+    externallyReachable_.assign(objects_.size(), false);
+    toMark_.clear();
+    for (uint32_t index: detached_) {
+      toMark_.push_back(index);
+    }
+    for (uint32_t index = 0; index < objects_.size(); ++index) {
+      auto* obj = objects_[index];
+      auto* objContainer = containerFor(obj);
+      if (objContainer == nullptr) continue;  // Permanent object.
+      int refCount;
+      // If object is in aggregated container - sum up RC for all elements.
+      if (objContainer->objectCount() != 1) {
+        RuntimeAssert(objContainer->frozen(), "Must be frozen aggregate");
+        ContainerHeader** subContainer = reinterpret_cast<ContainerHeader**>(objContainer + 1);
+        refCount = 0;
+        for (uint32_t i = 0; i < objContainer->objectCount(); ++i) {
+          refCount += innerRefCount(reinterpret_cast<ObjHeader*>((*subContainer) + 1));
+          subContainer++;
+        }
+      } else {
+        refCount = innerRefCounts_[index];
+      }
+      RuntimeAssert(refCount <= objContainer->refCount(), "Must properly count inner refs");
+      if (refCount != objContainer->refCount()) {
+        COLLECTOR_LOG("for %p mismatched RC: %d vs %d, adding as possible root\n", obj, refCount,
+            objContainer->refCount())
+        toMark_.push_back(index);
+      }
+    }
+    while (!toMark_.empty()) {
+      uint32_t index = toMark_.back();
+      toMark_.pop_back();
+      if (externallyReachable_[index]) continue;
+      externallyReachable_[index] = true;
+      auto* obj = objects_[index];
+      auto* objContainer = containerFor(obj);
+      if (objContainer == nullptr) continue;  // Permanent object.
+      RuntimeCheck(objContainer->shareable(), "Must be shareable");
+      if (atomicGet(&mutatedAtomics_) != 0) {
+        COLLECTOR_LOG("restarted during reachable visit\n")
+        return false;
+      }
+      traverseObjectFields(obj, [this](ObjHeader** location) {
+        ObjHeader* ref = *location;
+        if (ref == nullptr) return;
+        // Not found only if an atomic reference was changed, the analysis is restarted then.
+        uint32_t refIndex = objects_.find(ref);
+        if (refIndex != CyclicObjectIndex::kNotFound && !externallyReachable_[refIndex]) toMark_.push_back(refIndex);
+      });
+    }
+    return true;
+  }
+
+  // Finds atomic roots with matching reference counters, as only their destruction is controlled.
+  // Returns false if atomics were mutated meanwhile.
+  bool findReleaseCandidates() {
+    candidates_.clear();
+    for (uint32_t index = 0; index < objects_.size(); ++index) {
+      auto* obj = objects_[index];
+      // Only do that for atomic rootset elements. For them we also do not have sum up references from
+      // other elements of an aggregate, as atomic references are always in single object containers.
+      if (externallyReachable_[index] || !isAtomicReference(obj)) {
+        continue;
+      }
+      if (atomicGet(&mutatedAtomics_) != 0) {
+        COLLECTOR_LOG("restarted during matching check\n")
+        return false;
+      }
+      auto* objContainer = containerFor(obj);
+      if (!objContainer->frozen()) continue;
+      RuntimeAssert(objContainer->objectCount() == 1, "Must be single object");
+      COLLECTOR_LOG("for %p inner %d actual %d\n", obj, innerRefCounts_[index], objContainer->refCount());
+      // All references are inner. We compare the number of counted
+      // inner references with the number of non-stack references and per-thread ownership value
+      // (see rememberNewContainer()).
+      if (innerRefCounts_[index] == objContainer->refCount()) {
+        COLLECTOR_LOG("adding %p to release candidates\n", obj);
+        candidates_.push_back(obj);
+      }
+    }
+    return true;
+  }
+
   void gcProcessor() {
      {
        Locker locker(&lock_);
-       KStdDeque<ObjHeader*> toVisit;
-       KStdUnorderedSet<ObjHeader*> visited;
-       KStdUnorderedMap<ObjHeader*, int> sideRefCounts;
-       int restartCount = 0;
        while (!terminateCollector_) {
          CHECK_CALL(pthread_cond_wait(&cond_, &lock_), "Cannot wait collector condition");
          if (!shallRunCollector_) continue;
          atomicSet(&gcRunning_, 1);
-         restartCount = 0;
-        restart:
          COLLECTOR_LOG("start cycle GC\n");
-         if (restartCount > 10 && !terminateCollector_) {
-           COLLECTOR_LOG("wait for some time to avoid GC thrashing\n");
-           uint64_t nsDelta = 1000LL * 1000LL * (restartCount - 10);
-           WaitOnCondVar(&cond_, &lock_, nsDelta);
-         }
-         atomicSet(&mutatedAtomics_, 0);
-         visited.clear();
-         toVisit.clear();
-         sideRefCounts.clear();
-         for (auto* root: rootset_) {
-           // We only care about frozen values here, as only they could become part of shared cycles.
-           if (!containerFor(root)->frozen()) continue;
-           COLLECTOR_LOG("process root %p\n", root);
-           toVisit.push_back(root);
-           sideRefCounts[root] = 0;
-         }
-         while (toVisit.size() > 0)  {
-           if (atomicGet(&mutatedAtomics_) != 0) {
-             COLLECTOR_LOG("restarted during rootset visit\n")
-             restartCount++;
-             goto restart;
-           }
-           auto* obj = toVisit.front();
-           toVisit.pop_front();
-           COLLECTOR_LOG("visit %s%p\n", isAtomicReference(obj) ? "atomic " : "", obj);
-           auto* objContainer = containerFor(obj);
-           if (objContainer == nullptr) continue;  // Permanent object.
-           RuntimeCheck(objContainer->shareable(), "Must be shareable");
-           if (visited.count(obj) == 0) {
-             visited.insert(obj);
-             traverseObjectFields(obj, [&toVisit, obj, &sideRefCounts](ObjHeader** location) {
-                ObjHeader* ref = *location;
-                if (ref != nullptr) {
-                  COLLECTOR_LOG("object field %p in %p\n", ref, obj)
-                  int increment;
-                  // We shall not account for edges inside the same frozen container, unless it originates
-                  // from an atomic reference.
-                  if (isAtomicReference(obj) || (containerFor(obj) != containerFor(ref))) {
-                    COLLECTOR_LOG("counting %p -> %p\n", obj, ref)
-                    increment = 1;
-                  } else {
-                    COLLECTOR_LOG("not counting %p -> %p\n", obj, ref)
-                    increment = 0;
-                  }
-                  sideRefCounts[ref] += increment;
-                  toVisit.push_back(ref);
-                }
-             });
+#if TRACE_COLLECTOR
+         auto startTimeUs = konan::getTimeMicros();
+#endif
+         int restartCount = 0;
+         bool fromScratch = true;
+         while (true) {
+           if (restartCount > 10 && !terminateCollector_) {
+             COLLECTOR_LOG("wait for some time to avoid GC thrashing\n");
+             uint64_t nsDelta = 1000LL * 1000LL * (restartCount - 10);
+             WaitOnCondVar(&cond_, &lock_, nsDelta);
+             // Objects could be released while the lock was not held.
+             fromScratch = true;
            }
-         }
-         // Now find all elements with external references, and mark objects reachable from them as non suitable
-         // for collection by setting their side reference count to -1.
-         toVisit.clear();
-         for (auto it: sideRefCounts) {
-           auto* obj = it.first;
-           auto* objContainer = containerFor(obj);
-           if (objContainer == nullptr) continue;  // Permanent object.
-           int refCount;
-           // If object is in aggregated container - sum up RC for all elements.
-           if (objContainer->objectCount() != 1) {
-             RuntimeAssert(objContainer->frozen(), "Must be frozen aggregate");
-             ContainerHeader** subContainer = reinterpret_cast<ContainerHeader**>(objContainer + 1);
-             refCount = 0;
-             for (uint32_t i = 0; i < objContainer->objectCount(); ++i) {
-                 auto* componentObj = reinterpret_cast<ObjHeader*>((*subContainer) + 1);
-                 refCount += sideRefCounts[componentObj];
-                 subContainer++;
-               }
+           atomicSet(&mutatedAtomics_, 0);
+           if (fromScratch) {
+             resetAnalysis();
+             fromScratch = false;
            } else {
-             refCount = it.second;
-           }
-           RuntimeAssert(refCount <= objContainer->refCount(), "Must properly count inner refs");
-           if (refCount != objContainer->refCount()) {
-             COLLECTOR_LOG("for %p mismatched RC: %d vs %d, adding as possible root\n", obj, refCount, objContainer->refCount())
-             toVisit.push_back(it.first);
+             updateMutatedEdges();
            }
+           if (countInnerReferences() && markExternallyReachable() && findReleaseCandidates()) break;
+           restartCount++;
          }
-         visited.clear();
-         while (toVisit.size() > 0)  {
-           auto* obj = toVisit.front();
-           toVisit.pop_front();
-           auto* objContainer = containerFor(obj);
-           if (objContainer == nullptr) continue;  // Permanent object.
-           RuntimeCheck(objContainer->shareable(), "Must be shareable");
-           sideRefCounts[obj] = -1;
-           visited.insert(obj);
-           if (atomicGet(&mutatedAtomics_) != 0) {
-             COLLECTOR_LOG("restarted during reachable visit\n")
-             restartCount++;
-             goto restart;
-           }
-           traverseObjectFields(obj, [&toVisit, &visited](ObjHeader** location) {
-              ObjHeader* ref = *location;
-              if (ref != nullptr && (visited.count(ref) == 0)) {
-                toVisit.push_back(ref);
-              }
-           });
-         }
-         // Now release all atomic roots with matching reference counters, as only their destruction is controlled.
-         for (auto it: sideRefCounts) {
-           auto* obj = it.first;
-           // Only do that for atomic rootset elements. For them we also do not have sum up references from
-           // other elements of an aggregate, as atomic references are always in single object containers.
-           if (!isAtomicReference(obj)) {
-             continue;
-           }
-           if (atomicGet(&mutatedAtomics_) != 0) {
-             COLLECTOR_LOG("restarted during matching check\n")
-             restartCount++;
-             goto restart;
-           }
-           auto* objContainer = containerFor(obj);
-           if (!objContainer->frozen()) continue;
-           RuntimeAssert(objContainer->objectCount() == 1, "Must be single object");
-           COLLECTOR_LOG("for %p inner %d actual %d\n", obj, it.second, objContainer->refCount());
-           // All references are inner. We compare the number of counted
-           // inner references with the number of non-stack references and per-thread ownership value
-           // (see rememberNewContainer()).
-           if (it.second == objContainer->refCount()) {
-             COLLECTOR_LOG("adding %p to release candidates\n", it.first);
-             toRelease_.insert(it.first);
-           }
+         for (auto* obj: candidates_) {
+           toRelease_.insert(obj);
          }
          if (toRelease_.size() > 0)
            atomicSet(&pendingRelease_, 1);
          atomicSet(&gcRunning_, 0);
          shallRunCollector_ = false;
-         COLLECTOR_LOG("end cycle GC\n");
+         COLLECTOR_LOG("end cycle GC: %u objects, %d restarts, %llu us\n", objects_.size(), restartCount,
+             static_cast<unsigned long long>(konan::getTimeMicros() - startTimeUs));
        }
      }
      atomicSet(&terminateCollector_, false);
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_CYCLIC_OBJECT_INDEX_H
+#define RUNTIME_CYCLIC_OBJECT_INDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include "Types.h"
+
+struct ObjHeader;
+
+/**
+ * Open addressing hash table numbering objects in the order of insertion, so that per-object data of the collector
+ * is kept in plain vectors indexed by these numbers.
+ */
+class CyclicObjectIndex {
+  static constexpr uint32_t kEmpty = 0;
+
+  // Object numbers plus one, kEmpty for free slots. Capacity is a power of two, at least twice the size.
+  KStdVector<uint32_t> slots_;
+  KStdVector<ObjHeader*> objects_;
+
+  size_t slotFor(ObjHeader* obj) const {
+    // Fibonacci hashing, objects are at least 8 bytes aligned.
+    auto hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(obj) >> 3) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(hash >> 32) & (slots_.size() - 1);
+  }
+
+  void rehash(size_t capacity) {
+    slots_.assign(capacity, kEmpty);
+    for (uint32_t index = 0; index < objects_.size(); ++index) {
+      size_t slot = slotFor(objects_[index]);
+      while (slots_[slot] != kEmpty) slot = (slot + 1) & (slots_.size() - 1);
+      slots_[slot] = index + 1;
+    }
+  }
+
+ public:
+  static constexpr uint32_t kNotFound = static_cast<uint32_t>(-1);
+
+  CyclicObjectIndex() {
+    slots_.assign(64, kEmpty);
+  }
+
+  uint32_t size() const { return objects_.size(); }
+
+  ObjHeader* operator[](uint32_t index) const { return objects_[index]; }
+
+  uint32_t find(ObjHeader* obj) const {
+    for (size_t slot = slotFor(obj); slots_[slot] != kEmpty; slot = (slot + 1) & (slots_.size() - 1)) {
+      uint32_t index = slots_[slot] - 1;
+      if (objects_[index] == obj) return index;
+    }
+    return kNotFound;
+  }
+
+  // Returns the number of obj, and whether it was added by this call.
+  std::pair<uint32_t, bool> insert(ObjHeader* obj) {
+    size_t slot = slotFor(obj);
+    for (; slots_[slot] != kEmpty; slot = (slot + 1) & (slots_.size() - 1)) {
+      uint32_t index = slots_[slot] - 1;
+      if (objects_[index] == obj) return {index, false};
+    }
+    uint32_t index = objects_.size();
+    objects_.push_back(obj);
+    slots_[slot] = index + 1;
+    if (objects_.size() * 2 > slots_.size()) rehash(slots_.size() * 2);
+    return {index, true};
+  }
+
+  void clear() {
+    objects_.clear();
+    std::fill(slots_.begin(), slots_.end(), kEmpty);
+  }
+};
+
+#endif  // RUNTIME_CYCLIC_OBJECT_INDEX_H
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "CyclicObjectIndex.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+// The index never dereferences objects, so any aligned address will do.
+ObjHeader* FakeObject(uintptr_t address) {
+    return reinterpret_cast<ObjHeader*>(address);
+}
+
+} // namespace
+
+TEST(CyclicObjectIndexTest, Empty) {
+    CyclicObjectIndex index;
+
+    EXPECT_THAT(index.size(), 0);
+    EXPECT_THAT(index.find(FakeObject(0x1000)), CyclicObjectIndex::kNotFound);
+}
+
+TEST(CyclicObjectIndexTest, NumbersInInsertionOrder) {
+    CyclicObjectIndex index;
+    ObjHeader* first = FakeObject(0x3000);
+    ObjHeader* second = FakeObject(0x1000);
+
+    EXPECT_THAT(index.insert(first), testing::Pair(0, true));
+    EXPECT_THAT(index.insert(second), testing::Pair(1, true));
+    EXPECT_THAT(index.insert(first), testing::Pair(0, false));
+
+    EXPECT_THAT(index.size(), 2);
+    EXPECT_THAT(index.find(first), 0);
+    EXPECT_THAT(index.find(second), 1);
+    EXPECT_THAT(index[0], first);
+    EXPECT_THAT(index[1], second);
+    EXPECT_THAT(index.find(FakeObject(0x2000)), CyclicObjectIndex::kNotFound);
+}
+
+TEST(CyclicObjectIndexTest, Grow) {
+    constexpr uint32_t kCount = 10000;
+    CyclicObjectIndex index;
+    // Page aligned addresses only differ in high bits, which the hash must spread anyway.
+    for (uint32_t i = 0; i < kCount; ++i) {
+        ASSERT_THAT(index.insert(FakeObject((i + 1) * 4096)), testing::Pair(i, true));
+    }
+
+    EXPECT_THAT(index.size(), kCount);
+    for (uint32_t i = 0; i < kCount; ++i) {
+        EXPECT_THAT(index.find(FakeObject((i + 1) * 4096)), i);
+        EXPECT_THAT(index[i], FakeObject((i + 1) * 4096));
+    }
+    EXPECT_THAT(index.find(FakeObject((kCount + 1) * 4096)), CyclicObjectIndex::kNotFound);
+}
+
+TEST(CyclicObjectIndexTest, Clear) {
+    CyclicObjectIndex index;
+    for (uintptr_t address = 8; address <= 1000 * 8; address += 8) {
+        index.insert(FakeObject(address));
+    }
+
+    index.clear();
+
+    EXPECT_THAT(index.size(), 0);
+    EXPECT_THAT(index.find(FakeObject(8)), CyclicObjectIndex::kNotFound);
+    EXPECT_THAT(index.insert(FakeObject(16)), testing::Pair(0, true));
+    EXPECT_THAT(index.find(FakeObject(16)), 0);
+}
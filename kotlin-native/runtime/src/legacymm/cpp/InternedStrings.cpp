@@ -0,0 +1,63 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include <string.h>
+
+#include "ConcurrentWeakHashSet.hpp"
+#include "Memory.h"
+#include "MemoryPrivate.hpp"
+#include "Natives.h"
+
+#include "polyhash/PolyHash.h"
+
+namespace {
+
+struct InternedStringTraits {
+  static size_t Hash(const ObjHeader* string) noexcept {
+    auto* array = string->array();
+    return static_cast<uint32_t>(polyHash(array->count_, CharArrayAddressOfElementAt(array, 0)));
+  }
+
+  static bool Equals(const ObjHeader* lhs, const ObjHeader* rhs) noexcept {
+    auto* lhsArray = lhs->array();
+    auto* rhsArray = rhs->array();
+    return lhsArray->count_ == rhsArray->count_ &&
+        memcmp(CharArrayAddressOfElementAt(lhsArray, 0),
+               CharArrayAddressOfElementAt(rhsArray, 0),
+               lhsArray->count_ * sizeof(KChar)) == 0;
+  }
+
+  static bool TryRetain(ObjHeader* string) noexcept {
+    return TryAddHeapRef(string);
+  }
+};
+
+// Strings are removed from here by the memory manager, see `RemoveInternedString`.
+kotlin::ConcurrentWeakHashSet<ObjHeader, InternedStringTraits> internedStrings [[clang::no_destroy]];
+
+} // namespace
+
+extern "C" {
+
+OBJ_GETTER(InternString, ObjHeader* string) {
+  // Stack-allocated strings die with their frame, so the table must not see them.
+  if (string->local()) RETURN_OBJ(string);
+  auto result = internedStrings.FindOrInsert(string);
+  if (result.second) {
+    // Permanent strings are never destroyed, no need to track them.
+    if (!string->permanent()) MarkAsInternedString(string);
+    RETURN_OBJ(string);
+  }
+  ObjHeader* interned = result.first;
+  UpdateReturnRef(OBJ_RESULT, interned);
+  ReleaseHeapRefNoCollect(interned); // Balance `TryRetain`.
+  return interned;
+}
+
+RUNTIME_NOTHROW void RemoveInternedString(ObjHeader* string) {
+  internedStrings.Erase(string);
+}
+
+} // extern "C"
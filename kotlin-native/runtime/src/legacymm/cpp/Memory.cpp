@@ -40,6 +40,7 @@
 #endif  // USE_CYCLIC_GC
 #include "Exceptions.h"
 #include "FinalizerHooks.hpp"
+#include "FixedSizePool.hpp"
 #include "FreezeHooks.hpp"
 #include "KString.h"
 #include "Memory.h"
@@ -49,6 +50,7 @@
 #include "ObjectTraversal.hpp"
 #include "Porting.h"
 #include "Runtime.h"
+#include "SingletonLock.hpp"
 #include "Utils.hpp"
 #include "WorkerBoundReference.h"
 #include "Weak.h"
@@ -127,6 +129,8 @@ constexpr size_t kMaxGcAllocThreshold = 8 * 1024 * 1024;
 constexpr double kGcCollectCyclesLoadRatio = 0.3;
 // Minimum time of cycles collection to change thresholds.
 constexpr size_t kGcCollectCyclesMinimumDuration = 200;
+// Number of values of atomic and weak references remembered per thread, must be a power of two.
+constexpr size_t kRememberedValuesSize = 32;
 
 #endif  // USE_GC
 
@@ -157,6 +161,10 @@ volatile int aliveMemoryStatesCount = 0;
 KBoolean g_hasCyclicCollector = true;
 #endif  // USE_CYCLIC_GC
 
+// Meta objects are created for every weak reference target, interned string and so on, so they are allocated from
+// slabs rather than one by one.
+kotlin::FixedSizePool<sizeof(MetaObjHeader), alignof(MetaObjHeader)> metaObjectPool [[clang::no_destroy]];
+
 // TODO: Consider using ObjHolder.
 class ScopedRefHolder : private kotlin::MoveOnly {
  public:
@@ -503,6 +511,11 @@ void ObjHeader::SetAssociatedObject(void* obj) {
 
 #endif // KONAN_OBJC_INTEROP
 
+/**
+ * Keeps references released on foreign threads until the owning thread processes them. Releasing threads write
+ * into fixed size blocks: a slot is claimed by an atomic increment of the block counter, then the reference is
+ * stored into it. The owning thread reads the blocks in order and returns processed ones to a pool of free blocks.
+ */
 class ForeignRefManager {
  public:
   static ForeignRefManager* create() {
@@ -511,6 +524,16 @@ class ForeignRefManager {
     return result;
   }
 
+  ForeignRefManager() {
+    head = konanConstructInstance<Block>();
+    current = head;
+  }
+
+  ~ForeignRefManager() {
+    freeBlocks(head);
+    freeBlocks(freeList);
+  }
+
   void addRef() {
     atomicAdd(&refCount, 1);
   }
@@ -529,7 +552,7 @@ class ForeignRefManager {
 
   bool tryReleaseRefOwned() {
     if (atomicAdd(&this->refCount, -1) == 0) {
-      if (this->releaseList != nullptr) {
+      if (this->hasEnqueuedReleaseRefs()) {
         // There are no more holders of [this] to process the enqueued work items in [releaseRef].
         // Revert the reference counter back and notify the caller to process and then retry:
         atomicAdd(&this->refCount, 1);
@@ -543,46 +566,105 @@ class ForeignRefManager {
   }
 
   void enqueueReleaseRef(ObjHeader* obj) {
-    ListNode* newListNode = konanConstructInstance<ListNode>();
-    newListNode->obj = obj;
     while (true) {
-      ListNode* next = this->releaseList;
-      newListNode->next = next;
-      if (compareAndSet(&this->releaseList, next, newListNode)) break;
+      Block* block = atomicGet(&current);
+      uint32_t slot = atomicAdd(&block->claimed, 1u) - 1;
+      if (slot < kBlockSize) {
+        atomicSet(&block->refs[slot], obj);
+        return;
+      }
+      if (slot == kBlockSize) {
+        // Exactly one thread overflows the current block, it links the next one.
+        Block* next = newBlock();
+        next->refs[0] = obj;
+        atomicSet(&next->claimed, 1u);
+        atomicSet(&block->next, next);
+        atomicSet(&current, next);
+        return;
+      }
+      // Wait until the next block is linked. [block] may be recycled meanwhile, but its counter stays above
+      // kBlockSize until it is current again, and claiming a slot in a current block is fine.
+      while (atomicGet(&current) == block && atomicGet(&block->claimed) > kBlockSize) {}
     }
   }
 
   template <typename func>
   void processEnqueuedReleaseRefsWith(func process) {
-    if (releaseList == nullptr) return;
-
-    ListNode* toProcess = nullptr;
-
     while (true) {
-      toProcess = releaseList;
-      if (compareAndSet<ListNode*>(&this->releaseList, toProcess, nullptr)) break;
-    }
-
-    while (toProcess != nullptr) {
-      process(toProcess->obj);
-      ListNode* next = toProcess->next;
-      konanDestructInstance(toProcess);
-      toProcess = next;
+      Block* block = head;
+      uint32_t claimed = std::min(atomicGet(&block->claimed), kBlockSize);
+      while (readIndex < claimed) {
+        ObjHeader* obj = atomicGet(&block->refs[readIndex]);
+        // The slot is claimed, but not yet written: leave it for the next time.
+        if (obj == nullptr) return;
+        block->refs[readIndex] = nullptr;
+        readIndex++;
+        process(obj);
+      }
+      Block* next = atomicGet(&block->next);
+      if (readIndex < kBlockSize || next == nullptr) return;
+      head = next;
+      readIndex = 0;
+      recycleBlock(block);
     }
   }
 
 private:
-  int refCount;
+  static constexpr uint32_t kBlockSize = 126;
 
-  struct ListNode {
-    ObjHeader* obj;
-    ListNode* next;
+  struct Block {
+    Block* volatile next = nullptr;
+    // Number of claimed slots, exceeds kBlockSize once the block is full.
+    volatile uint32_t claimed = 0;
+    ObjHeader* volatile refs[kBlockSize] = {};
   };
 
-  ListNode* volatile releaseList;
+  int refCount = 0;
+
+  // Block where new references are written.
+  Block* volatile current = nullptr;
+  // Block being processed by the owning thread, and the index of the next slot to process there.
+  Block* head = nullptr;
+  uint32_t readIndex = 0;
+  // Processed blocks. Only the owning thread pushes and only the thread overflowing the current block pops,
+  // so there is at most one thread of each kind, and the stack is not subject to ABA.
+  Block* volatile freeList = nullptr;
+
+  static void freeBlocks(Block* block) {
+    while (block != nullptr) {
+      Block* next = block->next;
+      konanDestructInstance(block);
+      block = next;
+    }
+  }
+
+  Block* newBlock() {
+    while (true) {
+      Block* block = atomicGet(&freeList);
+      if (block == nullptr) return konanConstructInstance<Block>();
+      if (compareAndSet(&freeList, block, block->next)) {
+        block->next = nullptr;
+        return block;
+      }
+    }
+  }
+
+  void recycleBlock(Block* block) {
+    // Slots of processed blocks are already cleared, and the counter is above kBlockSize, as the block was
+    // overflowed to link the next one.
+    while (true) {
+      Block* top = atomicGet(&freeList);
+      block->next = top;
+      if (compareAndSet(&freeList, top, block)) return;
+    }
+  }
+
+  bool hasEnqueuedReleaseRefs() {
+    return readIndex < std::min(atomicGet(&head->claimed), kBlockSize) || atomicGet(&head->next) != nullptr;
+  }
 
   void processAbandoned() {
-    if (this->releaseList != nullptr) {
+    if (this->hasEnqueuedReleaseRefs()) {
       bool hadNoStateInitialized = (memoryState == nullptr);
 
       if (hadNoStateInitialized) {
@@ -675,6 +757,65 @@ private:
 
 } // namespace
 
+// Scratch space of freezeSubgraph. Each thread keeps one between calls, so that freezing doesn't allocate
+// once it has grown to the size of the usual graphs.
+struct FreezeState {
+  struct Node {
+    ContainerHeader* container;
+    // Bits of the container header overwritten by the node index while the node is on the stack.
+    uint32_t savedSizeBits;
+    uint32_t lowLink;
+  };
+
+  struct Frame {
+    uint32_t node;
+    // Edges of the node yet to be followed are edges[edgesBegin, edges.size()).
+    size_t edgesBegin;
+  };
+
+  // Containers visited when running freeze hooks.
+  ContainerHeaderList visited;
+  // Nodes of the graph in the order of visiting, indexed by their Tarjan indices.
+  KStdVector<Node> nodes;
+  KStdVector<Frame> frames;
+  ContainerHeaderList edges;
+  KStdVector<uint32_t> stack;
+  // Containers referred from FreezableAtomicReference, which are visited after the rest of the graph.
+  ContainerHeaderList deferred;
+  // Strongly connected components in reversed topological order, i-th one ends at componentEnds[i].
+  ContainerHeaderList components;
+  KStdVector<size_t> componentEnds;
+  // Indices not fitting into container headers.
+  KStdUnorderedMap<ContainerHeader*, uint32_t> largeIndices;
+
+  void clear() {
+    // runFreezeHooksRecursive() resets the containers it visits before returning, and freeze hooks can't throw.
+    RuntimeAssert(visited.empty(), "Containers visited by freeze hooks must have been reset");
+    clear(visited);
+    clear(nodes);
+    clear(frames);
+    clear(edges);
+    clear(stack);
+    clear(deferred);
+    clear(components);
+    clear(componentEnds);
+    largeIndices.clear();
+  }
+
+ private:
+  // Buffers grown by exceptionally large graphs are released.
+  static constexpr size_t kMaxKeptCapacity = 1 << 16;
+
+  template <typename T>
+  static void clear(KStdVector<T>& vector) {
+    if (vector.capacity() > kMaxKeptCapacity) {
+      KStdVector<T>().swap(vector);
+    } else {
+      vector.clear();
+    }
+  }
+};
+
 struct MemoryState {
 #if TRACE_MEMORY
   // Set of all containers.
@@ -716,6 +857,11 @@ struct MemoryState {
   uint64_t lastCyclicGcTimestamp;
   uint32_t gcEpoque;
 
+  // Values of atomic and weak references remembered by this thread (see readHeapRefLocked()), with the GC
+  // epoque they were remembered in. Direct mapped by the value address.
+  ObjHeader* rememberedValues[kRememberedValuesSize];
+  uint32_t rememberedValueEpoques[kRememberedValuesSize];
+
   uint64_t allocSinceLastGc;
   uint64_t allocSinceLastGcThreshold;
 #endif // USE_GC
@@ -723,6 +869,9 @@ struct MemoryState {
   // A stack of initializing singletons.
   KStdVector<std::pair<ObjHeader**, ObjHeader*>> initializingSingletons;
 
+  // Not in use by a running freezeSubgraph, if not null.
+  FreezeState* freezeState = nullptr;
+
   bool isMainThread = false;
 
 #if COLLECT_STATISTIC
@@ -1076,11 +1225,11 @@ ContainerHeader* allocContainer(MemoryState* state, size_t size) {
   return result;
 }
 
-ContainerHeader* allocAggregatingFrozenContainer(KStdVector<ContainerHeader*>& containers) {
-  auto componentSize = containers.size();
+ContainerHeader* allocAggregatingFrozenContainer(ContainerHeader* const* containers, size_t componentSize) {
   auto* superContainer = allocContainer(memoryState, sizeof(ContainerHeader) + sizeof(void*) * componentSize);
   auto* place = reinterpret_cast<ContainerHeader**>(superContainer + 1);
-  for (auto* container : containers) {
+  for (size_t i = 0; i < componentSize; ++i) {
+    auto* container = containers[i];
     *place++ = container;
     // Set link to the new container.
     auto* obj = reinterpret_cast<ObjHeader*>(container + 1);
@@ -1111,25 +1260,38 @@ void processFinalizerQueue(MemoryState* state) {
   RuntimeAssert(state->finalizerQueueSize == 0, "Queue must be empty here");
 }
 
-bool hasExternalRefs(ContainerHeader* start, ContainerHeaderSet* visited) {
-  ContainerHeaderDeque toVisit;
-  toVisit.push_back(start);
-  while (!toVisit.empty()) {
-    auto* container = toVisit.front();
-    toVisit.pop_front();
-    visited->insert(container);
-    if (container->refCount() > 0) {
-      MEMORY_LOG("container %p with rc %d blocks transfer\n", container, container->refCount())
-      return true;
-    }
-    traverseContainerReferredObjects(container, [&toVisit, visited](ObjHeader* ref) {
-        auto* child = containerFor(ref);
-        if (!isShareable(child) && (visited->count(child) == 0)) {
-           toVisit.push_front(child);
-        }
-     });
+/**
+ * Collects local containers reachable from start into subgraph and marks them. If dropInternalRefs is set, also
+ * decrements reference counters by the number of references from inside of the subgraph, restoreInternalRefs()
+ * undoes that.
+ */
+void markSubgraph(ContainerHeader* start, ContainerHeaderList* subgraph, bool dropInternalRefs) {
+  start->mark();
+  subgraph->push_back(start);
+  for (size_t index = 0; index < subgraph->size(); ++index) {
+    traverseContainerReferredObjects((*subgraph)[index], [subgraph, dropInternalRefs](ObjHeader* ref) {
+      auto* child = containerFor(ref);
+      RuntimeAssert(!isArena(child), "A reference to local object is encountered");
+      if (isShareable(child))
+        return;
+      if (dropInternalRefs)
+        child->decRefCount<false>();
+      if (!child->marked()) {
+        child->mark();
+        subgraph->push_back(child);
+      }
+    });
+  }
+}
+
+void restoreInternalRefs(const ContainerHeaderList& subgraph) {
+  for (auto* container : subgraph) {
+    traverseContainerReferredObjects(container, [](ObjHeader* ref) {
+      auto* child = containerFor(ref);
+      if (!isShareable(child))
+        child->incRefCount<false>();
+    });
   }
-  return false;
 }
 
 #endif  // USE_GC
@@ -1216,84 +1378,6 @@ void freeContainer(ContainerHeader* container) {
   }
 }
 
-/**
-  * Do DFS cycle detection with three colors:
-  *  - 'marked' bit as BLACK marker (object and its descendants processed)
-  *  - 'seen' bit as GRAY marker (object is being processed)
-  *  - not 'marked' and not 'seen' as WHITE marker (object is unprocessed)
-  * When we see GREY during DFS, it means we see cycle.
-  */
-void depthFirstTraversal(ContainerHeader* start, bool* hasCycles,
-                         KRef* firstBlocker, KStdVector<ContainerHeader*>* order) {
-  ContainerHeaderDeque toVisit;
-  toVisit.push_back(start);
-  start->setSeen();
-
-  while (!toVisit.empty()) {
-    auto* container = toVisit.front();
-    toVisit.pop_front();
-    if (isMarkedAsRemoved(container)) {
-      container = clearRemoved(container);
-      // Mark BLACK.
-      container->resetSeen();
-      container->mark();
-      order->push_back(container);
-      continue;
-    }
-    toVisit.push_front(markAsRemoved(container));
-    traverseContainerReferredObjects(container, [container, hasCycles, firstBlocker, &toVisit](ObjHeader* obj) {
-      if (*firstBlocker != nullptr)
-        return;
-      if (obj->has_meta_object() && ((obj->meta_object()->flags_ & MF_NEVER_FROZEN) != 0)) {
-          *firstBlocker = obj;
-          return;
-      }
-      ContainerHeader* objContainer = containerFor(obj);
-      if (canFreeze(objContainer)) {
-        // Marked GREY, there's cycle.
-        if (objContainer->seen()) *hasCycles = true;
-
-        // Go deeper if WHITE.
-        if (!objContainer->seen() && !objContainer->marked()) {
-          // Mark GRAY.
-          objContainer->setSeen();
-          // Here we do rather interesting trick: when doing DFS we postpone processing references going from
-          // FreezableAtomic, so that in 'order' referred value will be seen as not actually belonging
-          // to the same SCC (unless there are other edges not going through FreezableAtomic reaching the same value).
-          if (isFreezableAtomic(container)) {
-            toVisit.push_back(objContainer);
-          } else {
-            toVisit.push_front(objContainer);
-          }
-        }
-      }
-    });
-  }
-}
-
-void traverseStronglyConnectedComponent(ContainerHeader* start,
-                                        KStdUnorderedMap<ContainerHeader*,
-                                            KStdVector<ContainerHeader*>> const* reversedEdges,
-                                        KStdVector<ContainerHeader*>* component) {
-  ContainerHeaderDeque toVisit;
-  toVisit.push_back(start);
-  start->mark();
-
-  while (!toVisit.empty()) {
-    auto* container = toVisit.front();
-    toVisit.pop_front();
-    component->push_back(container);
-    auto it = reversedEdges->find(container);
-    RuntimeAssert(it != reversedEdges->end(), "unknown node during condensation building");
-    for (auto* nextContainer : it->second) {
-      if (!nextContainer->marked()) {
-          nextContainer->mark();
-          toVisit.push_front(nextContainer);
-      }
-    }
-  }
-}
-
 template <bool Atomic>
 inline bool tryIncrementRC(ContainerHeader* container) {
   return container->tryIncRefCount<Atomic>();
@@ -2128,6 +2212,8 @@ void deinitMemory(MemoryState* memoryState, bool destroyRuntime) {
   PRINT_EVENT(memoryState)
   DEINIT_EVENT(memoryState)
 
+  if (memoryState->freezeState != nullptr)
+    konanDestructInstance(memoryState->freezeState);
   konanFreeMemory(memoryState);
   ::memoryState = nullptr;
 }
@@ -2390,19 +2476,18 @@ OBJ_GETTER(initSingleton, ObjHeader** location, const TypeInfo* typeInfo, void (
   }
 #endif  // KONAN_NO_EXCEPTIONS
 #else  // KONAN_NO_THREADS
-  // Search from the top of the stack.
-  for (auto it = memoryState->initializingSingletons.rbegin(); it != memoryState->initializingSingletons.rend(); ++it) {
-    if (it->first == location) {
-      RETURN_OBJ(it->second);
+  // Only a singleton being initialized may be initialized by this thread.
+  if (atomicGet(location) == kInitializingSingleton) {
+    // Search from the top of the stack.
+    auto& initializingSingletons = memoryState->initializingSingletons;
+    for (auto it = initializingSingletons.rbegin(); it != initializingSingletons.rend(); ++it) {
+      if (it->first == location) {
+        RETURN_OBJ(it->second);
+      }
     }
   }
 
-  ObjHeader* initializing = kInitializingSingleton;
-
-  // Spin lock.
-  ObjHeader* value = nullptr;
-  while ((value = __sync_val_compare_and_swap(location, nullptr, initializing)) == initializing);
-  if (value != nullptr) {
+  if (ObjHeader* value = kotlin::LockSingleton(location)) {
     // OK'ish, inited by someone else.
     RETURN_OBJ(value);
   }
@@ -2414,6 +2499,7 @@ OBJ_GETTER(initSingleton, ObjHeader** location, const TypeInfo* typeInfo, void (
     FreezeSubgraph(object);
   UpdateHeapRef(location, object);
   synchronize();
+  kotlin::WakeSingletonWaiters(location);
   memoryState->initializingSingletons.pop_back();
   return object;
 #else  // KONAN_NO_EXCEPTIONS
@@ -2423,6 +2509,7 @@ OBJ_GETTER(initSingleton, ObjHeader** location, const TypeInfo* typeInfo, void (
       FreezeSubgraph(object);
     UpdateHeapRef(location, object);
     synchronize();
+    kotlin::WakeSingletonWaiters(location);
     memoryState->initializingSingletons.pop_back();
     return object;
   } catch (...) {
@@ -2430,6 +2517,7 @@ OBJ_GETTER(initSingleton, ObjHeader** location, const TypeInfo* typeInfo, void (
     zeroHeapRef(location);
     memoryState->initializingSingletons.pop_back();
     synchronize();
+    kotlin::WakeSingletonWaiters(location);
     throw;
   }
 #endif  // KONAN_NO_EXCEPTIONS
@@ -2449,6 +2537,29 @@ inline int32_t computeCookie() {
   return (static_cast<int32_t>(reinterpret_cast<intptr_t>(state))) ^ static_cast<int32_t>(epoque);
 }
 
+#if USE_GC
+inline size_t rememberedValueIndex(const ObjHeader* value) {
+  return (reinterpret_cast<uintptr_t>(value) >> 4) & (kRememberedValuesSize - 1);
+}
+
+/**
+ * Whether the container of value was remembered by this thread since the last GC. Such a container is retained by
+ * the pending decrement in toRelease until the next GC, so the value may be returned without any synchronization.
+ * Note that value must not be dereferenced here, as it may be already destroyed otherwise.
+ */
+inline bool isRememberedValue(MemoryState* state, const ObjHeader* value) {
+  auto index = rememberedValueIndex(value);
+  return state->rememberedValues[index] == value && state->rememberedValueEpoques[index] == state->gcEpoque;
+}
+
+// Epoque must be taken before rememberNewContainer(), as the latter may run GC itself.
+inline void setRememberedValue(MemoryState* state, ObjHeader* value, uint32_t epoque) {
+  auto index = rememberedValueIndex(value);
+  state->rememberedValues[index] = value;
+  state->rememberedValueEpoques[index] = epoque;
+}
+#endif  // USE_GC
+
 OBJ_GETTER(swapHeapRefLocked,
     ObjHeader** location, ObjHeader* expectedValue, ObjHeader* newValue, int32_t* spinlock, int32_t* cookie) {
   lock(spinlock);
@@ -2497,6 +2608,17 @@ void setHeapRefLocked(ObjHeader** location, ObjHeader* newValue, int32_t* spinlo
 
 OBJ_GETTER(readHeapRefLocked, ObjHeader** location, int32_t* spinlock, int32_t* cookie) {
   MEMORY_LOG("ReadHeapRefLocked: %p\n", location)
+#if USE_GC
+  if (IsStrictMemoryModel()) {
+    // Neither the lock nor the cookie is written, if the value is known to be retained by this thread,
+    // so that threads reading the same reference don't contend.
+    ObjHeader* value = atomicGet(location);
+    if (value == nullptr || isRememberedValue(memoryState, value)) {
+      UpdateReturnRef(OBJ_RESULT, value);
+      return value;
+    }
+  }
+#endif  // USE_GC
   lock(spinlock);
   ObjHeader* value = *location;
   auto realCookie = computeCookie();
@@ -2506,7 +2628,9 @@ OBJ_GETTER(readHeapRefLocked, ObjHeader** location, int32_t* spinlock, int32_t*
 #if USE_GC
   if (IsStrictMemoryModel() && shallRemember && value != nullptr) {
     auto* container = containerFor(value);
+    auto epoque = memoryState->gcEpoque;
     rememberNewContainer(container);
+    setRememberedValue(memoryState, value, epoque);
   }
 #endif  // USE_GC
   unlock(spinlock);
@@ -2697,57 +2821,73 @@ bool clearSubgraphReferences(ObjHeader* root, bool checked) {
   // Free cyclic garbage to decrease number of analyzed objects.
   checkIfForceCyclicGcNeeded(state);
 
-  ContainerHeaderSet visited;
-  if (!checked) {
-    hasExternalRefs(container, &visited);
-  } else {
-    // Now decrement RC of elements in toRelease set for reachibility analysis.
-    for (auto it = state->toRelease->begin(); it != state->toRelease->end(); ++it) {
-      auto released = *it;
-      if (!isMarkedAsRemoved(released) && released->local()) {
-        released->decRefCount<false>();
-      }
+  // The 'marked' bit tells containers of the subgraph from the rest of the heap.
+  ContainerHeaderList subgraph;
+  markSubgraph(container, &subgraph, checked);
+  // Pending decrements of the subgraph. The toRelease list may be long, so it's only scanned once for them.
+  KStdVector<ContainerHeader**> released;
+  for (auto& entry : *state->toRelease) {
+    if (!isMarkedAsRemoved(entry) && entry->local() && entry->marked()) {
+      released.push_back(&entry);
+    }
+  }
+  if (checked) {
+    // Now reference counters of the subgraph only count references from outside of it. Apply pending
+    // decrements and drop the reference of the caller, anything left is an external reference.
+    for (auto* entry : released) {
+      (*entry)->decRefCount<false>();
     }
     container->decRefCount<false>();
-    markGray<false>(container);
-    auto bad = hasExternalRefs(container, &visited);
-    scanBlack<false>(container);
-    // Restore original RC.
-    container->incRefCount<false>();
-    for (auto it = state->toRelease->begin(); it != state->toRelease->end(); ++it) {
-       auto released = *it;
-       if (!isMarkedAsRemoved(released) && released->local()) {
-         released->incRefCount<false>();
-       }
+    bool bad = false;
+    for (auto* member : subgraph) {
+      if (member->refCount() > 0) {
+        MEMORY_LOG("container %p with rc %d blocks transfer\n", member, member->refCount())
+        bad = true;
+        break;
+      }
     }
+    // Restore original RC, except for the pending decrements of a transferred subgraph, applied for good below.
+    container->incRefCount<false>();
+    restoreInternalRefs(subgraph);
     if (bad) {
+      for (auto* entry : released) {
+        (*entry)->incRefCount<false>();
+      }
+      for (auto* member : subgraph) {
+        member->unMark();
+      }
       return false;
     }
   }
 
-  // Remove all no longer owned containers from GC structures.
-  // TODO: not very efficient traversal.
-  for (auto it = state->toFree->begin(); it != state->toFree->end(); ++it) {
+  // Remove all no longer owned containers from GC structures. Only buffered containers are in the toFree list.
+  size_t bufferedCount = 0;
+  for (auto* member : subgraph) {
+    if (member->buffered()) ++bufferedCount;
+  }
+  for (auto it = state->toFree->begin(); bufferedCount > 0 && it != state->toFree->end(); ++it) {
     auto container = *it;
-    if (visited.count(container) != 0) {
+    if (!isMarkedAsRemoved(container) && container->marked()) {
       MEMORY_LOG("removing %p from the toFree list\n", container)
       container->resetBuffered();
       container->setColorAssertIfGreen(CONTAINER_TAG_GC_BLACK);
       *it = markAsRemoved(container);
+      --bufferedCount;
     }
   }
-  for (auto it = state->toRelease->begin(); it != state->toRelease->end(); ++it) {
-    auto container = *it;
-    if (!isMarkedAsRemoved(container) && visited.count(container) != 0) {
-      MEMORY_LOG("removing %p from the toRelease list\n", container)
-      container->decRefCount<false>();
-      *it = markAsRemoved(container);
-    }
+  for (auto* entry : released) {
+    MEMORY_LOG("removing %p from the toRelease list\n", *entry)
+    if (!checked)
+      (*entry)->decRefCount<false>();
+    *entry = markAsRemoved(*entry);
+  }
+  for (auto* member : subgraph) {
+    member->unMark();
   }
 
 #if TRACE_MEMORY
   // Forget transferred containers.
-  for (auto* it: visited) {
+  for (auto* it: subgraph) {
     state->containers->erase(it);
   }
 #endif
@@ -2756,82 +2896,184 @@ bool clearSubgraphReferences(ObjHeader* root, bool checked) {
   return true;
 }
 
-void freezeAcyclic(ContainerHeader* rootContainer, ContainerHeaderSet* newlyFrozen) {
-  KStdDeque<ContainerHeader*> queue;
-  queue.push_back(rootContainer);
-  while (!queue.empty()) {
-    ContainerHeader* current = queue.front();
-    queue.pop_front();
-    current->unMark();
-    current->resetBuffered();
-    current->setColorUnlessGreen(CONTAINER_TAG_GC_BLACK);
-    // Note, that once object is frozen, it could be concurrently accessed, so
-    // color and similar attributes shall not be used.
-    if (!current->frozen())
-      newlyFrozen->insert(current);
-    MEMORY_LOG("freezing %p\n", current)
-    current->freeze();
-    traverseContainerReferredObjects(current, [&queue](ObjHeader* obj) {
-        ContainerHeader* objContainer = containerFor(obj);
-        if (canFreeze(objContainer)) {
-          if (objContainer->marked())
-            queue.push_back(objContainer);
-        }
+// Gives freezeSubgraph the scratch space of the current thread. A nested freezeSubgraph, e.g. from a freeze hook,
+// gets a new one.
+class FreezeStateHolder {
+ public:
+  FreezeStateHolder() : state_(memoryState->freezeState) {
+    memoryState->freezeState = nullptr;
+    if (state_ == nullptr)
+      state_ = konanConstructInstance<FreezeState>();
+  }
+
+  ~FreezeStateHolder() {
+    state_->clear();
+    if (memoryState->freezeState == nullptr)
+      memoryState->freezeState = state_;
+    else
+      konanDestructInstance(state_);
+  }
+
+  FreezeState* get() { return state_; }
+
+ private:
+  FreezeState* state_;
+};
+
+void runFreezeHooksRecursive(ContainerHeader* rootContainer, FreezeState* state) {
+  // The 'seen' bit marks visited containers, and is reset when all hooks are run.
+  auto& visited = state->visited;
+  rootContainer->setSeen();
+  visited.push_back(rootContainer);
+  for (size_t index = 0; index < visited.size(); ++index) {
+    ContainerHeader* container = visited[index];
+    traverseContainerObjects(container, [](ObjHeader* obj) {
+      kotlin::RunFreezeHooks(obj);
+    });
+    traverseContainerReferredObjects(container, [&visited](ObjHeader* obj) {
+      ContainerHeader* objContainer = containerFor(obj);
+      // Only iterating on unseen containers which will get frozen.
+      if (canFreeze(objContainer) && !objContainer->seen()) {
+        objContainer->setSeen();
+        visited.push_back(objContainer);
+      }
     });
   }
+  for (auto* container : visited) {
+    container->resetSeen();
+  }
+  visited.clear();
 }
 
-void freezeCyclic(ObjHeader* root,
-                  const KStdVector<ContainerHeader*>& order,
-                  ContainerHeaderSet* newlyFrozen) {
-  KStdUnorderedMap<ContainerHeader*, KStdVector<ContainerHeader*>> reversedEdges;
-  KStdDeque<ObjHeader*> queue;
-  queue.push_back(root);
-  while (!queue.empty()) {
-    ObjHeader* current = queue.front();
-    queue.pop_front();
-    ContainerHeader* currentContainer = containerFor(current);
-    currentContainer->unMark();
-    reversedEdges.emplace(currentContainer, KStdVector<ContainerHeader*>(0));
-    traverseContainerReferredObjects(currentContainer, [current, currentContainer, &queue, &reversedEdges](ObjHeader* obj) {
-          ContainerHeader* objContainer = containerFor(obj);
-          if (canFreeze(objContainer)) {
-            if (objContainer->marked())
-              queue.push_back(obj);
-            // We ignore references from FreezableAtomicsReference during condensation, to avoid KT-33824.
-            if (!isFreezableAtomic(current))
-              reversedEdges.emplace(objContainer, KStdVector<ContainerHeader*>(0)).
-                first->second.push_back(currentContainer);
-          }
-      });
-   }
+// Tarjan indices are kept in the size bits of container headers, the largest value there means that the index is
+// in FreezeState::largeIndices.
+constexpr uint32_t kLargeFreezeIndex = (1u << (32 - CONTAINER_TAG_GC_SHIFT)) - 1;
 
-   KStdVector<KStdVector<ContainerHeader*>> components;
-   MEMORY_LOG("Condensation:\n");
-   // Enumerate in the topological order.
-   for (auto it = order.rbegin(); it != order.rend(); ++it) {
-     auto* container = *it;
-     if (container->marked()) continue;
-     KStdVector<ContainerHeader*> component;
-     traverseStronglyConnectedComponent(container, &reversedEdges, &component);
-     MEMORY_LOG("SCC:\n");
-  #if TRACE_MEMORY
-     for (auto c: component)
-       konan::consolePrintf("    %p\n", c);
-  #endif
-     components.push_back(std::move(component));
-   }
+inline void setFreezeIndex(FreezeState* state, ContainerHeader* container, uint32_t index) {
+  if (index >= kLargeFreezeIndex) {
+    state->largeIndices[container] = index;
+    index = kLargeFreezeIndex;
+  }
+  container->setSizeBits(index << CONTAINER_TAG_GC_SHIFT);
+}
 
-  // Enumerate strongly connected components in reversed topological order.
-  for (auto it = components.rbegin(); it != components.rend(); ++it) {
-    auto& component = *it;
+inline uint32_t freezeIndex(FreezeState* state, ContainerHeader* container) {
+  uint32_t index = container->sizeBits() >> CONTAINER_TAG_GC_SHIFT;
+  return index == kLargeFreezeIndex ? state->largeIndices.at(container) : index;
+}
+
+/**
+ * Starts a Tarjan DFS at container. Visited containers are 'marked', those on the Tarjan stack are also 'seen'.
+ * References from FreezableAtomicReference are postponed to FreezeState::deferred and don't count as edges of
+ * the graph, so that referred values are not seen as belonging to the same component (KT-33824).
+ * Returns false, if finds an object which must never be frozen.
+ */
+bool visitForFreezing(ContainerHeader* container, FreezeState* state, KRef* firstBlocker) {
+  uint32_t index = state->nodes.size();
+  state->nodes.push_back({container, container->sizeBits(), index});
+  state->stack.push_back(index);
+  state->frames.push_back({index, state->edges.size()});
+  container->mark();
+  container->setSeen();
+  auto& targets = isFreezableAtomic(container) ? state->deferred : state->edges;
+  traverseContainerReferredObjects(container, [firstBlocker, &targets](ObjHeader* obj) {
+    if (*firstBlocker != nullptr)
+      return;
+    if (obj->has_meta_object() && ((obj->meta_object()->flags_ & MF_NEVER_FROZEN) != 0)) {
+      *firstBlocker = obj;
+      return;
+    }
+    ContainerHeader* objContainer = containerFor(obj);
+    if (canFreeze(objContainer))
+      targets.push_back(objContainer);
+  });
+  if (*firstBlocker != nullptr)
+    return false;
+  // Objects are only traversed above, from now on the size bits hold the index.
+  setFreezeIndex(state, container, index);
+  return true;
+}
+
+bool findStronglyConnectedComponents(ContainerHeader* start, FreezeState* state, KRef* firstBlocker) {
+  if (!visitForFreezing(start, state, firstBlocker))
+    return false;
+  auto& nodes = state->nodes;
+  auto& frames = state->frames;
+  auto& edges = state->edges;
+  while (!frames.empty()) {
+    uint32_t current = frames.back().node;
+    if (edges.size() > frames.back().edgesBegin) {
+      ContainerHeader* next = edges.back();
+      edges.pop_back();
+      if (!next->marked()) {
+        if (!visitForFreezing(next, state, firstBlocker))
+          return false;
+      } else if (next->seen()) {
+        nodes[current].lowLink = std::min(nodes[current].lowLink, freezeIndex(state, next));
+      }
+      continue;
+    }
+    frames.pop_back();
+    uint32_t lowLink = nodes[current].lowLink;
+    if (lowLink == current) {
+      // The component consists of the current node and the nodes above it on the stack.
+      uint32_t member;
+      do {
+        member = state->stack.back();
+        state->stack.pop_back();
+        ContainerHeader* container = nodes[member].container;
+        container->setSizeBits(nodes[member].savedSizeBits);
+        container->resetSeen();
+        state->components.push_back(container);
+      } while (member != current);
+      state->componentEnds.push_back(state->components.size());
+    }
+    if (!frames.empty()) {
+      auto& parent = nodes[frames.back().node];
+      parent.lowLink = std::min(parent.lowLink, lowLink);
+    }
+  }
+  return true;
+}
+
+// Finds strongly connected components of the graph reachable from rootContainer, see freezeSubgraph().
+bool condenseForFreezing(ContainerHeader* rootContainer, FreezeState* state, KRef* firstBlocker) {
+  bool found = findStronglyConnectedComponents(rootContainer, state, firstBlocker);
+  while (found && !state->deferred.empty()) {
+    ContainerHeader* container = state->deferred.back();
+    state->deferred.pop_back();
+    if (!container->marked())
+      found = findStronglyConnectedComponents(container, state, firstBlocker);
+  }
+  if (!found) {
+    // Restore the visited containers.
+    for (auto& node : state->nodes) {
+      if (node.container->seen()) {
+        node.container->setSizeBits(node.savedSizeBits);
+        node.container->resetSeen();
+      }
+      node.container->unMark();
+    }
+  }
+  return found;
+}
+
+void freezeComponents(FreezeState* state) {
+  // Enumerate strongly connected components in reversed topological order, so that containers referred
+  // from other components are frozen by the time their component is counted.
+  size_t begin = 0;
+  for (size_t end : state->componentEnds) {
+    ContainerHeader** component = state->components.data() + begin;
+    size_t size = end - begin;
+    begin = end;
     int internalRefsCount = 0;
     int totalCount = 0;
-    for (auto* container : component) {
+    for (size_t i = 0; i < size; ++i) {
+      auto* container = component[i];
       RuntimeAssert(!isAggregatingFrozenContainer(container), "Must not be called on such containers");
       totalCount += container->refCount();
       if (isFreezableAtomic(container)) {
-        RuntimeAssert(component.size() == 1, "Must be trivial condensation");
+        RuntimeAssert(size == 1, "Must be trivial condensation");
         continue;
       }
       traverseContainerReferredObjects(container, [&internalRefsCount](ObjHeader* obj) {
@@ -2841,12 +3083,23 @@ void freezeCyclic(ObjHeader* root,
         });
     }
 
+    if (size == 1 && internalRefsCount == 0) {
+      // An acyclic part of the graph: the reference counter stays as is.
+      auto* container = component[0];
+      container->unMark();
+      container->resetBuffered();
+      container->setColorUnlessGreen(CONTAINER_TAG_GC_BLACK);
+      MEMORY_LOG("freezing %p\n", container)
+      container->freeze();
+      continue;
+    }
+
     // Freeze component.
-    for (auto* container : component) {
+    for (size_t i = 0; i < size; ++i) {
+      auto* container = component[i];
+      container->unMark();
       container->resetBuffered();
       container->setColorUnlessGreen(CONTAINER_TAG_GC_BLACK);
-      if (!container->frozen())
-        newlyFrozen->insert(container);
       // Note, that once object is frozen, it could be concurrently accessed, so
       // color and similar attributes shall not be used.
       MEMORY_LOG("freezing %p\n", container)
@@ -2857,33 +3110,11 @@ void freezeCyclic(ObjHeader* root,
     }
 
     // Create fictitious container for the whole component.
-    auto superContainer = component.size() == 1 ? component[0] : allocAggregatingFrozenContainer(component);
+    auto superContainer = size == 1 ? component[0] : allocAggregatingFrozenContainer(component, size);
     // Don't count internal references.
     MEMORY_LOG("Setting aggregating %p rc to %d (total %d inner %d)\n", \
        superContainer, totalCount - internalRefsCount, totalCount, internalRefsCount)
     superContainer->setRefCount(totalCount - internalRefsCount);
-    newlyFrozen->insert(superContainer);
-  }
-}
-
-void runFreezeHooksRecursive(ObjHeader* root) {
-  KStdUnorderedSet<KRef> seen;
-  KStdVector<KRef> toVisit;
-  seen.insert(root);
-  toVisit.push_back(root);
-  while (!toVisit.empty()) {
-    KRef obj = toVisit.back();
-    toVisit.pop_back();
-
-    kotlin::RunFreezeHooks(obj);
-
-    kotlin::traverseReferredObjects(obj, [&seen, &toVisit](ObjHeader* field) {
-      auto wasNotSeenYet = seen.insert(field).second;
-      // Only iterating on unseen objects which containers will get frozen by freezeCyclic or freezeAcyclic.
-      if (wasNotSeenYet && canFreeze(containerFor(field))) {
-        toVisit.push_back(field);
-      }
-    });
   }
 }
 
@@ -2899,7 +3130,8 @@ void runFreezeHooksRecursive(ObjHeader* root) {
  * it could be correctly released by just atomic decrement on reference counter, without additional
  * cycle collector run.
  * So during subgraph freezing operation, we perform the following steps:
- *   - run Kosoraju-Sharir algorithm to find strongly connected components
+ *   - run Tarjan's algorithm to find strongly connected components, keeping its state in container
+ *     headers and in vectors reused by the next freezing on the same thread
  *   - put all objects in each strongly connected component into an artificial container
  *     (we assume that they all were in single element containers initially), single-object
  *     components remain in the same container
@@ -2912,51 +3144,41 @@ void runFreezeHooksRecursive(ObjHeader* root) {
  */
 void freezeSubgraph(ObjHeader* root) {
   if (root == nullptr) return;
-  // First check that passed object graph has no cycles.
-  // If there are cycles - run graph condensation on cyclic graphs using Kosoraju-Sharir.
   ContainerHeader* rootContainer = containerFor(root);
   if (isPermanentOrFrozen(rootContainer)) return;
 
+  FreezeStateHolder state;
+
   MEMORY_LOG("Run freeze hooks on subgraph of %p\n", root);
 
   // Note: Actual freezing can fail, but these hooks won't be undone, and moreover
   // these hooks will run again on a repeated freezing attempt.
-  runFreezeHooksRecursive(root);
+  runFreezeHooksRecursive(rootContainer, state.get());
 
   MEMORY_LOG("Freeze subgraph of %p\n", root)
 
   #if USE_GC
-    auto state = memoryState;
+    auto memory = memoryState;
     // Free cyclic garbage to decrease number of analyzed objects.
-    checkIfForceCyclicGcNeeded(state);
+    checkIfForceCyclicGcNeeded(memory);
   #endif
 
-  // Do DFS cycle detection.
-  bool hasCycles = false;
   KRef firstBlocker = root->has_meta_object() && ((root->meta_object()->flags_ & MF_NEVER_FROZEN) != 0) ?
     root : nullptr;
-  KStdVector<ContainerHeader*> order;
-  depthFirstTraversal(rootContainer, &hasCycles, &firstBlocker, &order);
-  if (firstBlocker != nullptr) {
+  if (firstBlocker != nullptr || !condenseForFreezing(rootContainer, state.get(), &firstBlocker)) {
     MEMORY_LOG("See freeze blocker for %p: %p\n", root, firstBlocker)
     ThrowFreezingException(root, firstBlocker);
   }
-  ContainerHeaderSet newlyFrozen;
-  // Now unmark all marked objects, and freeze them, if no cycles detected.
-  if (hasCycles) {
-    freezeCyclic(root, order, &newlyFrozen);
-  } else {
-    freezeAcyclic(rootContainer, &newlyFrozen);
-  }
-  MEMORY_LOG("Graph of %p is %s with %d elements\n", root, hasCycles ? "cyclic" : "acyclic", newlyFrozen.size())
+  freezeComponents(state.get());
+  MEMORY_LOG("Graph of %p has %d containers in %d components\n", root, state.get()->components.size(),
+             state.get()->componentEnds.size())
 
 #if USE_GC
   // Now remove frozen objects from the toFree list.
   // TODO: optimize it by keeping ignored (i.e. freshly frozen) objects in the set,
   // and use it when analyzing toFree during collection.
-  for (auto& container : *(state->toFree)) {
+  for (auto& container : *(memory->toFree)) {
     if (!isMarkedAsRemoved(container) && container->frozen()) {
-      RuntimeAssert(newlyFrozen.count(container) != 0, "Must be newly frozen");
       container = markAsRemoved(container);
     }
   }
@@ -3116,7 +3338,7 @@ MetaObjHeader* ObjHeader::createMetaObject(ObjHeader* object) {
   }
 #endif
 
-  MetaObjHeader* meta = konanConstructInstance<MetaObjHeader>();
+  MetaObjHeader* meta = new (metaObjectPool.Allocate()) MetaObjHeader();
   meta->typeInfo_ = typeInfo;
 #if KONAN_NO_THREADS
   *location = reinterpret_cast<TypeInfo*>(meta);
@@ -3124,7 +3346,7 @@ MetaObjHeader* ObjHeader::createMetaObject(ObjHeader* object) {
   TypeInfo* old = __sync_val_compare_and_swap(location, typeInfo, reinterpret_cast<TypeInfo*>(meta));
   if (old != typeInfo) {
     // Someone installed a new meta-object since the check.
-    konanFreeMemory(meta);
+    metaObjectPool.Free(meta);
     meta = reinterpret_cast<MetaObjHeader*>(old);
   }
 #endif
@@ -3134,6 +3356,10 @@ MetaObjHeader* ObjHeader::createMetaObject(ObjHeader* object) {
 void ObjHeader::destroyMetaObject(ObjHeader* object) {
   TypeInfo** location = &object->typeInfoOrMeta_;
   MetaObjHeader* meta = clearPointerBits(*(reinterpret_cast<MetaObjHeader**>(location)), OBJECT_TAG_MASK);
+  if ((meta->flags_ & MF_INTERNED_STRING) != 0) {
+    // Must happen while the string contents are still valid, as the table rehashes it.
+    RemoveInternedString(object);
+  }
   *const_cast<const TypeInfo**>(location) = meta->typeInfo_;
   if (meta->WeakReference.counter_ != nullptr) {
     WeakReferenceCounterClear(meta->WeakReference.counter_);
@@ -3144,7 +3370,7 @@ void ObjHeader::destroyMetaObject(ObjHeader* object) {
   Kotlin_ObjCExport_releaseAssociatedObject(meta->associatedObject_);
 #endif
 
-  konanFreeMemory(meta);
+  metaObjectPool.Free(meta);
 }
 
 void ObjectContainer::Init(MemoryState* state, const TypeInfo* typeInfo) {
@@ -3617,6 +3843,11 @@ void EnsureNeverFrozen(ObjHeader* object) {
   ensureNeverFrozen(object);
 }
 
+RUNTIME_NOTHROW void MarkAsInternedString(ObjHeader* object) {
+  // Unlike `EnsureNeverFrozen`, strings are frozen and may be marked concurrently with other flags.
+  __sync_fetch_and_or(&object->meta_object()->flags_, MF_INTERNED_STRING);
+}
+
 void Kotlin_Any_share(ObjHeader* obj) {
   shareAny(obj);
 }
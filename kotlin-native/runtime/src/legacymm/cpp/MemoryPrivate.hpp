@@ -207,6 +207,15 @@ struct ContainerHeader {
     return (objectCount_ & CONTAINER_TAG_GC_HAS_OBJECT_COUNT) == 0;
   }
 
+  // Bits holding either the object count or the container size. Freezing temporarily stores other data there.
+  inline unsigned sizeBits() const {
+    return objectCount_ & ~CONTAINER_TAG_GC_MASK;
+  }
+
+  inline void setSizeBits(unsigned bits) {
+    objectCount_ = (objectCount_ & CONTAINER_TAG_GC_MASK) | bits;
+  }
+
   inline unsigned color() const {
     return objectCount_ & CONTAINER_TAG_GC_COLOR_MASK;
   }
@@ -330,6 +339,11 @@ MODEL_VARIANTS(void, LeaveFrame, ObjHeader** start, int parameters, int count);
 MODEL_VARIANTS(void, ReleaseHeapRef, const ObjHeader* object);
 MODEL_VARIANTS(void, ReleaseHeapRefNoCollect, const ObjHeader* object);
 
+// Make memory manager call `RemoveInternedString` when this string dies.
+void MarkAsInternedString(ObjHeader* obj) RUNTIME_NOTHROW;
+// Called by the memory manager right before a string marked with `MarkAsInternedString` is destroyed.
+void RemoveInternedString(ObjHeader* string) RUNTIME_NOTHROW;
+
 }  // extern "C"
 
 #endif // RUNTIME_MEMORYPRIVATE_HPP
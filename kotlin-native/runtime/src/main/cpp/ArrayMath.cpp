@@ -0,0 +1,127 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ArrayMath.hpp"
+
+#include <utility>
+
+#include "Exceptions.h"
+#include "Memory.h"
+#include "Natives.h"
+#include "Types.h"
+
+using namespace kotlin;
+
+extern "C" {
+
+KDouble Kotlin_math_sin(KDouble x);
+KDouble Kotlin_math_cos(KDouble x);
+KDouble Kotlin_math_sqrt(KDouble x);
+KDouble Kotlin_math_exp(KDouble x);
+KDouble Kotlin_math_ln(KDouble x);
+KDouble Kotlin_math_Double_pow(KDouble thiz, KDouble x);
+
+} // extern "C"
+
+namespace {
+
+// Checks ranges the same way `copyInto` does, returns the source and the destination of `count` elements.
+template <typename T>
+std::pair<const T*, T*> ArrayMathRanges(KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count) {
+    const ArrayHeader* array = thiz->array();
+    ArrayHeader* destinationArray = destination->array();
+    if (count < 0 || fromIndex < 0 || static_cast<uint32_t>(count) + fromIndex > array->count_ || toIndex < 0 ||
+        static_cast<uint32_t>(count) + toIndex > destinationArray->count_) {
+        ThrowArrayIndexOutOfBoundsException();
+    }
+    if (!destination->local() && isFrozen(destination)) {
+        ThrowInvalidMutabilityException(destination);
+    }
+    return {PrimitiveArrayAddressOfElementAt<T>(array, fromIndex),
+            PrimitiveArrayAddressOfElementAt<T>(destinationArray, toIndex)};
+}
+
+template <double (*Kernel)(double, uint64_t&), typename T>
+void ApplyToArray(
+        KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count, KDouble (*fallback)(KDouble)) {
+    auto [source, target] = ArrayMathRanges<T>(thiz, fromIndex, destination, toIndex, count);
+    ApplyMathKernel<Kernel>(source, target, count, fallback);
+}
+
+// sqrt is a single instruction on most targets and pow has no batch kernel: apply them element by element, going
+// backwards when the destination starts inside of the source range.
+template <typename T, typename Function>
+void MapArray(KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count, Function function) {
+    auto [source, target] = ArrayMathRanges<T>(thiz, fromIndex, destination, toIndex, count);
+    if (target <= source || target >= source + count) {
+        for (KInt i = 0; i < count; ++i) {
+            target[i] = static_cast<T>(function(source[i]));
+        }
+    } else {
+        for (KInt i = count - 1; i >= 0; --i) {
+            target[i] = static_cast<T>(function(source[i]));
+        }
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+void Kotlin_DoubleArray_expInto(KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count) {
+    ApplyToArray<ExpKernel, KDouble>(thiz, fromIndex, destination, toIndex, count, Kotlin_math_exp);
+}
+
+void Kotlin_DoubleArray_lnInto(KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count) {
+    ApplyToArray<LogKernel, KDouble>(thiz, fromIndex, destination, toIndex, count, Kotlin_math_ln);
+}
+
+void Kotlin_DoubleArray_sinInto(KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count) {
+    ApplyToArray<SinKernel, KDouble>(thiz, fromIndex, destination, toIndex, count, Kotlin_math_sin);
+}
+
+void Kotlin_DoubleArray_cosInto(KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count) {
+    ApplyToArray<CosKernel, KDouble>(thiz, fromIndex, destination, toIndex, count, Kotlin_math_cos);
+}
+
+void Kotlin_DoubleArray_sqrtInto(KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count) {
+    MapArray<KDouble>(thiz, fromIndex, destination, toIndex, count, Kotlin_math_sqrt);
+}
+
+void Kotlin_DoubleArray_powInto(
+        KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count, KDouble exponent) {
+    MapArray<KDouble>(thiz, fromIndex, destination, toIndex, count,
+                      [exponent](KDouble x) { return Kotlin_math_Double_pow(x, exponent); });
+}
+
+// Float arrays are computed in double precision, so that results are correctly rounded floats in almost all cases.
+
+void Kotlin_FloatArray_expInto(KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count) {
+    ApplyToArray<ExpKernel, KFloat>(thiz, fromIndex, destination, toIndex, count, Kotlin_math_exp);
+}
+
+void Kotlin_FloatArray_lnInto(KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count) {
+    ApplyToArray<LogKernel, KFloat>(thiz, fromIndex, destination, toIndex, count, Kotlin_math_ln);
+}
+
+void Kotlin_FloatArray_sinInto(KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count) {
+    ApplyToArray<SinKernel, KFloat>(thiz, fromIndex, destination, toIndex, count, Kotlin_math_sin);
+}
+
+void Kotlin_FloatArray_cosInto(KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count) {
+    ApplyToArray<CosKernel, KFloat>(thiz, fromIndex, destination, toIndex, count, Kotlin_math_cos);
+}
+
+void Kotlin_FloatArray_sqrtInto(KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count) {
+    MapArray<KFloat>(thiz, fromIndex, destination, toIndex, count, Kotlin_math_sqrt);
+}
+
+void Kotlin_FloatArray_powInto(
+        KConstRef thiz, KInt fromIndex, KRef destination, KInt toIndex, KInt count, KFloat exponent) {
+    MapArray<KFloat>(thiz, fromIndex, destination, toIndex, count,
+                     [exponent](KDouble x) { return Kotlin_math_Double_pow(x, exponent); });
+}
+
+} // extern "C"
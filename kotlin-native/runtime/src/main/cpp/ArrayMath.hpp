@@ -0,0 +1,252 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_ARRAY_MATH_H
+#define RUNTIME_ARRAY_MATH_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace kotlin {
+
+namespace internal {
+
+inline uint64_t DoubleBits(double value) noexcept {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+inline double DoubleFromBits(uint64_t bits) noexcept {
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Bits of |value|, which compare as integers the way magnitudes do, with NaNs above infinity.
+inline uint64_t MagnitudeBits(double value) noexcept {
+    return DoubleBits(value) & 0x7fffffffffffffff;
+}
+
+// 1 if `value` is above `limit`, 0 otherwise, for arguments below 2^63. Kernels compare with shifts because SSE2 has
+// no 64-bit integer comparisons, and converting double comparison masks to integers also stops vectorization there.
+inline uint64_t Above(uint64_t value, uint64_t limit) noexcept {
+    return (limit - value) >> 63;
+}
+
+// Adding and then subtracting it rounds a double with magnitude below 2^51 to an integer, the sum holds that integer
+// in its low bits.
+constexpr double kRoundingShift = 0x1.8p52;
+
+// ln(2) split so that multiplying the high part by an exponent is exact.
+constexpr double kLn2Hi = 0x1.62e42fee00000p-1;
+constexpr double kLn2Lo = 0x1.a39ef35793c76p-33;
+
+// pi/2 split into 33-bit parts, so that their products with |n| < 2^20 are exact.
+constexpr double kPiOver2Part1 = 0x1.921fb54400000p+0;
+constexpr double kPiOver2Part2 = 0x1.0b4611a600000p-34;
+constexpr double kPiOver2Part3 = 0x1.3198a2e000000p-69;
+constexpr double kPiOver2Tail = 0x1.b839a252049c1p-104;
+constexpr double kTwoOverPi = 0x1.45f306dc9c883p-1;
+
+// Conditionals on 0 or 1 `condition`, as bit operations that keep loops vectorizable.
+inline double SelectIf(uint64_t condition, double ifSet, double ifClear) noexcept {
+    uint64_t mask = 0 - condition;
+    return DoubleFromBits((DoubleBits(ifSet) & mask) | (DoubleBits(ifClear) & ~mask));
+}
+
+inline double NegateIf(uint64_t condition, double value) noexcept {
+    return DoubleFromBits(DoubleBits(value) ^ (condition << 63));
+}
+
+inline void TwoSum(double a, double b, double& sum, double& error) noexcept {
+    sum = a + b;
+    double b1 = sum - a;
+    error = (a - (sum - b1)) + (b - b1);
+}
+
+// Reduces x to hi + lo = x - n * pi/2 with |hi + lo| <= pi/4 and returns n mod 4. Works for |x| < 2^20 as long as
+// the result doesn't lose too many bits to cancellation.
+inline uint64_t ReducePiOver2(double x, double& hi, double& lo, uint64_t& slow) noexcept {
+    double shifted = x * kTwoOverPi + kRoundingShift;
+    uint64_t n = DoubleBits(shifted);
+    double k = shifted - kRoundingShift;
+    double s1, e1, s2, e2;
+    TwoSum(x - k * kPiOver2Part1, -(k * kPiOver2Part2), s1, e1);
+    TwoSum(s1, -(k * kPiOver2Part3), s2, e2);
+    double tail = (e1 + e2) - k * kPiOver2Tail;
+    double sum = s2 + tail;
+    // Without reduction (n == 0) x itself is exact and keeps the sign of zero.
+    uint64_t reduced = Above(MagnitudeBits(k), 0);
+    hi = SelectIf(reduced, sum, x);
+    lo = SelectIf(reduced, tail - (sum - s2), 0.0);
+    slow = Above(MagnitudeBits(x), DoubleBits(0x1p20)) | (reduced & Above(DoubleBits(0x1p-25), MagnitudeBits(hi)));
+    return n & 3;
+}
+
+// sin(hi + lo) for |hi + lo| <= pi/4, as fdlibm's __kernel_sin with Taylor coefficients up to x^17.
+inline double SinPolynomial(double hi, double lo) noexcept {
+    double z = hi * hi;
+    double v = z * hi;
+    double r = 1.0 / 355687428096000;
+    r = -1.0 / 1307674368000 + z * r;
+    r = 1.0 / 6227020800 + z * r;
+    r = -1.0 / 39916800 + z * r;
+    r = 1.0 / 362880 + z * r;
+    r = -1.0 / 5040 + z * r;
+    r = 1.0 / 120 + z * r;
+    return hi - ((z * (0.5 * lo - v * r) - lo) + v * (1.0 / 6));
+}
+
+// cos(hi + lo) for |hi + lo| <= pi/4, as fdlibm's __kernel_cos with Taylor coefficients up to x^18.
+inline double CosPolynomial(double hi, double lo) noexcept {
+    double z = hi * hi;
+    double r = -1.0 / 6402373705728000;
+    r = 1.0 / 20922789888000 + z * r;
+    r = -1.0 / 87178291200 + z * r;
+    r = 1.0 / 479001600 + z * r;
+    r = -1.0 / 3628800 + z * r;
+    r = 1.0 / 40320 + z * r;
+    r = -1.0 / 720 + z * r;
+    r = 1.0 / 24 + z * r;
+    r *= z;
+    double halfZ = 0.5 * z;
+    double w = 1.0 - halfZ;
+    return w + (((1.0 - w) - halfZ) + (z * r - hi * lo));
+}
+
+} // namespace internal
+
+// The kernels below are branch-free so that loops over them vectorize. Each one reports through `slow` that its
+// argument is outside of the range it handles, and the caller recomputes such elements with the scalar function.
+
+// e^x for |x| < 708, where neither the result nor the scale 2^n can overflow or become subnormal.
+inline double ExpKernel(double x, uint64_t& slow) noexcept {
+    slow = internal::Above(internal::MagnitudeBits(x), internal::DoubleBits(708.0));
+    double shifted = x * 0x1.71547652b82fep0 + internal::kRoundingShift;
+    uint64_t n = internal::DoubleBits(shifted);
+    double k = shifted - internal::kRoundingShift;
+    double r = (x - k * internal::kLn2Hi) - k * internal::kLn2Lo;
+    // Taylor series of e^r - 1 - r for |r| <= ln(2)/2.
+    double p = 1.0 / 6227020800;
+    p = 1.0 / 479001600 + r * p;
+    p = 1.0 / 39916800 + r * p;
+    p = 1.0 / 3628800 + r * p;
+    p = 1.0 / 362880 + r * p;
+    p = 1.0 / 40320 + r * p;
+    p = 1.0 / 5040 + r * p;
+    p = 1.0 / 720 + r * p;
+    p = 1.0 / 120 + r * p;
+    p = 1.0 / 24 + r * p;
+    p = 1.0 / 6 + r * p;
+    p = 0.5 + r * p;
+    double scale = internal::DoubleFromBits((n + 1023) << 52);
+    return scale + scale * (r + r * r * p);
+}
+
+// ln(x) for positive normal x, the reduction and the atanh series follow fdlibm's e_log.c.
+inline double LogKernel(double x, uint64_t& slow) noexcept {
+    uint64_t bits = internal::DoubleBits(x);
+    // Includes the sign bit, so it is above the largest exponent of normal numbers for negative x.
+    uint64_t biasedExponent = bits >> 52;
+    slow = internal::Above(biasedExponent, 0x7fe) | internal::Above(1, biasedExponent);
+    // x = 2^k * m with m in [sqrt(2)/2, sqrt(2)).
+    uint64_t offset = bits - 0x3fe6a09e667f3bcd;
+    uint64_t exponent = static_cast<uint64_t>(static_cast<int64_t>(offset) >> 52);
+    double m = internal::DoubleFromBits(bits - (exponent << 52));
+    // The exponent converted to double the same way ExpKernel gets it from a double.
+    double k = internal::DoubleFromBits(internal::DoubleBits(internal::kRoundingShift) + exponent);
+    k -= internal::kRoundingShift;
+    double f = m - 1.0;
+    double s = f / (2.0 + f);
+    double z = s * s;
+    // Series of 2 * atanh(s) / s - 2 in z = s^2.
+    double r = 2.0 / 21;
+    r = 2.0 / 19 + z * r;
+    r = 2.0 / 17 + z * r;
+    r = 2.0 / 15 + z * r;
+    r = 2.0 / 13 + z * r;
+    r = 2.0 / 11 + z * r;
+    r = 2.0 / 9 + z * r;
+    r = 2.0 / 7 + z * r;
+    r = 2.0 / 5 + z * r;
+    r = 2.0 / 3 + z * r;
+    r *= z;
+    double halfSquare = 0.5 * f * f;
+    return k * internal::kLn2Hi - ((halfSquare - (s * (halfSquare + r) + k * internal::kLn2Lo)) - f);
+}
+
+inline double SinKernel(double x, uint64_t& slow) noexcept {
+    double hi, lo;
+    uint64_t quadrant = internal::ReducePiOver2(x, hi, lo, slow);
+    double sin = internal::SinPolynomial(hi, lo);
+    double cos = internal::CosPolynomial(hi, lo);
+    return internal::NegateIf(quadrant >> 1, internal::SelectIf(quadrant & 1, cos, sin));
+}
+
+inline double CosKernel(double x, uint64_t& slow) noexcept {
+    double hi, lo;
+    uint64_t quadrant = internal::ReducePiOver2(x, hi, lo, slow);
+    double sin = internal::SinPolynomial(hi, lo);
+    double cos = internal::CosPolynomial(hi, lo);
+    return internal::NegateIf(((quadrant + 1) >> 1) & 1, internal::SelectIf(quadrant & 1, sin, cos));
+}
+
+namespace internal {
+
+// Elements are processed in chunks copied to the stack first, so that the destination may coincide with the source.
+constexpr size_t kArrayMathChunk = 64;
+
+template <double (*Kernel)(double, uint64_t&), typename T, typename Fallback>
+inline void ApplyChunk(const T* source, T* destination, size_t count, Fallback fallback) noexcept {
+    double arguments[kArrayMathChunk];
+    double results[kArrayMathChunk];
+    for (size_t i = 0; i < count; ++i) {
+        arguments[i] = source[i];
+    }
+    uint64_t slow[kArrayMathChunk];
+    uint64_t anySlow = 0;
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = Kernel(arguments[i], slow[i]);
+        anySlow |= slow[i];
+    }
+    if (anySlow) {
+        for (size_t i = 0; i < count; ++i) {
+            if (slow[i]) results[i] = fallback(arguments[i]);
+        }
+    }
+    for (size_t i = 0; i < count; ++i) {
+        destination[i] = static_cast<T>(results[i]);
+    }
+}
+
+} // namespace internal
+
+// Applies a batch kernel to `count` elements of `source` and writes the results to `destination`, which may overlap
+// `source`. Elements the kernel doesn't handle are computed with the scalar `fallback`. Float elements are computed in
+// double precision. Kernel results are within 1 ulp of the exact ones (see ArrayMathTest.cpp).
+template <double (*Kernel)(double, uint64_t&), typename T, typename Fallback>
+inline void ApplyMathKernel(const T* source, T* destination, size_t count, Fallback fallback) noexcept {
+    using internal::kArrayMathChunk;
+    if (destination <= source || destination >= source + count) {
+        for (size_t start = 0; start < count; start += kArrayMathChunk) {
+            size_t size = std::min(kArrayMathChunk, count - start);
+            internal::ApplyChunk<Kernel>(source + start, destination + start, size, fallback);
+        }
+    } else {
+        // The destination starts inside of the source range: go backwards not to overwrite elements yet to be read.
+        for (size_t end = count; end > 0;) {
+            size_t size = std::min(kArrayMathChunk, end);
+            end -= size;
+            internal::ApplyChunk<Kernel>(source + end, destination + end, size, fallback);
+        }
+    }
+}
+
+} // namespace kotlin
+
+#endif // RUNTIME_ARRAY_MATH_H
@@ -0,0 +1,166 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ArrayMath.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace kotlin;
+
+namespace {
+
+using Kernel = double (*)(double, uint64_t&);
+
+uint64_t Bits(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// Error of `result` in units in the last place of the exact value.
+double UlpError(double result, long double exact) {
+    double rounded = static_cast<double>(exact);
+    if (result == rounded) return 0;
+    double ulp = std::nextafter(std::fabs(rounded), std::numeric_limits<double>::infinity()) - std::fabs(rounded);
+    return static_cast<double>(std::fabs(result - exact) / ulp);
+}
+
+template <Kernel kernel>
+std::vector<double> Apply(const std::vector<double>& arguments, double (*fallback)(double)) {
+    std::vector<double> results(arguments.size());
+    ApplyMathKernel<kernel>(arguments.data(), results.data(), arguments.size(), fallback);
+    return results;
+}
+
+template <Kernel kernel>
+void CheckAccuracy(double (*fallback)(double), long double (*exact)(long double), double from, double to) {
+    std::mt19937_64 random(42);
+    std::uniform_real_distribution<double> distribution(from, to);
+    std::vector<double> arguments(100000);
+    for (auto& argument : arguments) {
+        argument = distribution(random);
+    }
+    auto results = Apply<kernel>(arguments, fallback);
+    for (size_t i = 0; i < arguments.size(); ++i) {
+        ASSERT_LT(UlpError(results[i], exact(arguments[i])), 1.0) << std::hexfloat << arguments[i];
+    }
+}
+
+// Arguments outside of the kernel range must give exactly what the scalar function does.
+template <Kernel kernel>
+void CheckSpecialValues(double (*fallback)(double)) {
+    constexpr double kInf = std::numeric_limits<double>::infinity();
+    std::vector<double> arguments = {
+            0.0, -0.0, std::numeric_limits<double>::quiet_NaN(), kInf, -kInf, 1e-310, -1e-310,
+            std::numeric_limits<double>::max(), 708.5, -745.5, 0x1p21, -3e6, -1.0};
+    auto results = Apply<kernel>(arguments, fallback);
+    for (size_t i = 0; i < arguments.size(); ++i) {
+        if (std::isnan(results[i])) {
+            EXPECT_TRUE(std::isnan(fallback(arguments[i]))) << arguments[i];
+        } else {
+            EXPECT_EQ(Bits(fallback(arguments[i])), Bits(results[i])) << arguments[i];
+        }
+    }
+}
+
+double Exp(double x) {
+    return std::exp(x);
+}
+
+double Log(double x) {
+    return std::log(x);
+}
+
+double Sin(double x) {
+    return std::sin(x);
+}
+
+double Cos(double x) {
+    return std::cos(x);
+}
+
+} // namespace
+
+TEST(ArrayMathTest, ExpAccuracy) {
+    CheckAccuracy<ExpKernel>(Exp, expl, -745, 710);
+    CheckAccuracy<ExpKernel>(Exp, expl, -1, 1);
+}
+
+TEST(ArrayMathTest, LogAccuracy) {
+    CheckAccuracy<LogKernel>(Log, logl, 0, 1e300);
+    CheckAccuracy<LogKernel>(Log, logl, 1e-300, 1e-290);
+    CheckAccuracy<LogKernel>(Log, logl, 0.5, 2);
+}
+
+TEST(ArrayMathTest, SinCosAccuracy) {
+    CheckAccuracy<SinKernel>(Sin, sinl, -4, 4);
+    CheckAccuracy<SinKernel>(Sin, sinl, -1e6, 1e6);
+    CheckAccuracy<CosKernel>(Cos, cosl, -4, 4);
+    CheckAccuracy<CosKernel>(Cos, cosl, -1e6, 1e6);
+}
+
+TEST(ArrayMathTest, SinCosNearMultiplesOfPiOver2) {
+    std::vector<double> arguments;
+    for (int n = -1000; n <= 1000; ++n) {
+        double multiple = n * M_PI_2;
+        arguments.push_back(multiple);
+        arguments.push_back(std::nextafter(multiple, 0.0));
+        arguments.push_back(multiple + 1e-9);
+    }
+    auto sin = Apply<SinKernel>(arguments, Sin);
+    auto cos = Apply<CosKernel>(arguments, Cos);
+    for (size_t i = 0; i < arguments.size(); ++i) {
+        EXPECT_LT(UlpError(sin[i], sinl(arguments[i])), 1.0) << std::hexfloat << arguments[i];
+        EXPECT_LT(UlpError(cos[i], cosl(arguments[i])), 1.0) << std::hexfloat << arguments[i];
+    }
+}
+
+TEST(ArrayMathTest, SpecialValues) {
+    CheckSpecialValues<ExpKernel>(Exp);
+    CheckSpecialValues<LogKernel>(Log);
+    CheckSpecialValues<SinKernel>(Sin);
+    CheckSpecialValues<CosKernel>(Cos);
+}
+
+TEST(ArrayMathTest, Float) {
+    std::vector<float> arguments;
+    for (int i = -1000; i <= 1000; ++i) {
+        arguments.push_back(i * 0.125f);
+    }
+    std::vector<float> results(arguments.size());
+    ApplyMathKernel<ExpKernel>(arguments.data(), results.data(), arguments.size(), Exp);
+    for (size_t i = 0; i < arguments.size(); ++i) {
+        EXPECT_EQ(static_cast<float>(std::exp(static_cast<double>(arguments[i]))), results[i]) << arguments[i];
+    }
+}
+
+TEST(ArrayMathTest, OverlappingRanges) {
+    std::vector<double> arguments;
+    for (int i = 0; i < 1000; ++i) {
+        arguments.push_back(i * 0.01);
+    }
+    auto expected = Apply<ExpKernel>(arguments, Exp);
+    for (size_t shift : {0, 1, 63, 64, 65, 500}) {
+        std::vector<double> forward(arguments);
+        forward.resize(arguments.size() + shift);
+        // Destination after the source.
+        std::vector<double> backward(forward);
+        ApplyMathKernel<ExpKernel>(backward.data(), backward.data() + shift, arguments.size(), Exp);
+        // Destination before the source.
+        std::copy(arguments.begin(), arguments.end(), forward.begin() + shift);
+        ApplyMathKernel<ExpKernel>(forward.data() + shift, forward.data(), arguments.size(), Exp);
+        for (size_t i = 0; i < arguments.size(); ++i) {
+            ASSERT_EQ(expected[i], backward[i + shift]) << shift << " " << i;
+            ASSERT_EQ(expected[i], forward[i]) << shift << " " << i;
+        }
+    }
+}
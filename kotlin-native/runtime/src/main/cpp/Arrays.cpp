@@ -14,14 +14,18 @@
  * limitations under the License.
  */
 
+#include <math.h>
 #include <stdio.h>
 #include <string.h>
+#include <algorithm>
 
 #include "KAssert.h"
 #include "Exceptions.h"
 #include "Memory.h"
 #include "Natives.h"
+#include "PrimitiveArraySort.hpp"
 #include "Types.h"
+#include "polyhash/PolyHash.h"
 
 extern "C" void checkRangeIndexes(KInt from, KInt to, KInt size);
 
@@ -43,15 +47,151 @@ ALWAYS_INLINE inline void boundsCheck(const ArrayHeader* array, KInt index) {
   }
 }
 
+template<typename T>
+ALWAYS_INLINE inline bool isZeroBits(T value) {
+  T zero;
+  memset(&zero, 0, sizeof(T));
+  return memcmp(&value, &zero, sizeof(T)) == 0;
+}
+
 template<typename T>
 inline void fillImpl(KRef thiz, KInt fromIndex, KInt toIndex, T value) {
   ArrayHeader* array = thiz->array();
   checkRangeIndexes(fromIndex, toIndex, array->count_);
   mutabilityCheck(thiz);
   T* address = PrimitiveArrayAddressOfElementAt<T>(array, fromIndex);
-  for (KInt index = fromIndex; index < toIndex; ++index) {
-    *address++ = value;
+  KInt count = toIndex - fromIndex;
+  // memset is the best vectorized fill the platform has, but it can only repeat a single byte.
+  if (sizeof(T) == 1 || isZeroBits(value)) {
+    uint8_t byte;
+    memcpy(&byte, &value, 1);
+    memset(address, byte, count * sizeof(T));
+  } else {
+    std::fill_n(address, count, value);
+  }
+}
+
+template<typename T>
+inline KBoolean contentEqualsImpl(KConstRef thiz, KConstRef other) {
+  const ArrayHeader* array = thiz->array();
+  const ArrayHeader* otherArray = other->array();
+  if (array->count_ != otherArray->count_) return false;
+  // Only valid for types with a single representation of each value, i.e. not for floating point.
+  return memcmp(PrimitiveArrayAddressOfElementAt<T>(array, 0),
+                PrimitiveArrayAddressOfElementAt<T>(otherArray, 0),
+                array->count_ * sizeof(T)) == 0;
+}
+
+// Search works in blocks: the comparisons within a block have no early exit, so they are vectorized.
+constexpr size_t kSearchBlockSize = 64;
+
+template<typename T>
+inline KInt indexOfImpl(KConstRef thiz, T element) {
+  const ArrayHeader* array = thiz->array();
+  const T* data = PrimitiveArrayAddressOfElementAt<T>(array, 0);
+  KInt count = array->count_;
+  if (sizeof(T) == 1) {
+    const void* found = memchr(data, static_cast<uint8_t>(element), count);
+    return found == nullptr ? -1 : static_cast<const T*>(found) - data;
+  }
+  constexpr KInt kBlock = kSearchBlockSize / sizeof(T);
+  KInt index = 0;
+  for (; index + kBlock <= count; index += kBlock) {
+    bool found = false;
+    for (KInt i = 0; i < kBlock; ++i) found |= data[index + i] == element;
+    if (found) break;
+  }
+  for (; index < count; ++index) {
+    if (data[index] == element) return index;
+  }
+  return -1;
+}
+
+template<typename T>
+inline KInt lastIndexOfImpl(KConstRef thiz, T element) {
+  const ArrayHeader* array = thiz->array();
+  const T* data = PrimitiveArrayAddressOfElementAt<T>(array, 0);
+  constexpr KInt kBlock = kSearchBlockSize / sizeof(T);
+  KInt end = array->count_;
+  for (; end >= kBlock; end -= kBlock) {
+    bool found = false;
+    for (KInt i = end - kBlock; i < end; ++i) found |= data[i] == element;
+    if (found) break;
+  }
+  for (KInt index = end - 1; index >= 0; --index) {
+    if (data[index] == element) return index;
+  }
+  return -1;
+}
+
+// Same as `hashCode` of the corresponding boxed value.
+ALWAYS_INLINE inline uint32_t elementHashCode(KByte value) { return value; }
+ALWAYS_INLINE inline uint32_t elementHashCode(KShort value) { return value; }
+ALWAYS_INLINE inline uint32_t elementHashCode(KInt value) { return value; }
+ALWAYS_INLINE inline uint32_t elementHashCode(KBoolean value) { return value ? 1231 : 1237; }
+
+ALWAYS_INLINE inline uint32_t elementHashCode(KLong value) {
+  uint64_t bits = value;
+  return static_cast<uint32_t>(bits ^ (bits >> 32));
+}
+
+ALWAYS_INLINE inline uint32_t elementHashCode(KFloat value) {
+  // All NaNs are hashed as the canonical one, like in `Float.toBits()`.
+  uint32_t bits = 0x7fc00000;
+  if (!isnan(value)) memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+ALWAYS_INLINE inline uint32_t elementHashCode(KDouble value) {
+  // All NaNs are hashed as the canonical one, like in `Double.toBits()`.
+  uint64_t bits = 0x7ff8000000000000ULL;
+  if (!isnan(value)) memcpy(&bits, &value, sizeof(bits));
+  return static_cast<uint32_t>(bits ^ (bits >> 32));
+}
+
+template<typename T>
+inline KInt contentHashCodeImpl(KConstRef thiz) {
+  const ArrayHeader* array = thiz->array();
+  const T* data = PrimitiveArrayAddressOfElementAt<T>(array, 0);
+  KInt count = array->count_;
+  // Multiply once per 4 elements to shorten the dependency chain on `result`.
+  constexpr uint32_t p1 = 31, p2 = p1 * 31, p3 = p2 * 31, p4 = p3 * 31;
+  uint32_t result = 1;
+  KInt index = 0;
+  for (; index + 4 <= count; index += 4) {
+    result = result * p4 + elementHashCode(data[index]) * p3 + elementHashCode(data[index + 1]) * p2 +
+        elementHashCode(data[index + 2]) * p1 + elementHashCode(data[index + 3]);
+  }
+  for (; index < count; ++index) {
+    result = result * 31 + elementHashCode(data[index]);
+  }
+  return result;
+}
+
+template<>
+inline KInt contentHashCodeImpl<KChar>(KConstRef thiz) {
+  const ArrayHeader* array = thiz->array();
+  KInt count = array->count_;
+  // The hash starts from 1 rather than 0, so 31^count has to be added to the vectorized polynomial hash.
+  uint32_t power = 1;
+  uint32_t base = 31;
+  for (uint32_t exponent = count; exponent != 0; exponent >>= 1) {
+    if (exponent & 1) power *= base;
+    base *= base;
   }
+  return power + static_cast<uint32_t>(polyHash(count, PrimitiveArrayAddressOfElementAt<KChar>(array, 0)));
+}
+
+// See `Platform.isParallelArraySortingActive`.
+bool g_parallelArraySorting = false;
+
+template<typename T>
+inline void sortImpl(KRef thiz, KInt fromIndex, KInt toIndex) {
+  ArrayHeader* array = thiz->array();
+  checkRangeIndexes(fromIndex, toIndex, array->count_);
+  mutabilityCheck(thiz);
+  kotlin::SortPrimitives(PrimitiveArrayAddressOfElementAt<T>(array, fromIndex), toIndex - fromIndex,
+                         g_parallelArraySorting);
 }
 
 template<typename T>
@@ -86,6 +226,82 @@ inline T PrimitiveArrayGet(KConstRef thiz, KInt index) {
   return *PrimitiveArrayAddressOfElementAt<T>(array, index);
 }
 
+#if __BIG_ENDIAN__
+constexpr bool kHostBigEndian = true;
+#else
+constexpr bool kHostBigEndian = false;
+#endif  // __BIG_ENDIAN__
+
+template<size_t Size> struct SwapWord;
+
+template<> struct SwapWord<2> {
+  using Type = uint16_t;
+  static ALWAYS_INLINE inline Type swap(Type value) { return __builtin_bswap16(value); }
+};
+
+template<> struct SwapWord<4> {
+  using Type = uint32_t;
+  static ALWAYS_INLINE inline Type swap(Type value) { return __builtin_bswap32(value); }
+};
+
+template<> struct SwapWord<8> {
+  using Type = uint64_t;
+  static ALWAYS_INLINE inline Type swap(Type value) { return __builtin_bswap64(value); }
+};
+
+// Copies `count` primitives of type T, reversing byte order of each one if `swap` is set.
+// Both pointers may be unaligned: accesses go through memcpy, which compiles to plain loads and
+// stores where the target allows that, and the swapping loop gets vectorized into byte shuffles.
+template<typename T>
+inline void copyPrimitives(void* destination, const void* source, KInt count, bool swap) {
+  if (!swap) {
+    memcpy(destination, source, count * sizeof(T));
+    return;
+  }
+  using Word = SwapWord<sizeof(T)>;
+  uint8_t* to = reinterpret_cast<uint8_t*>(destination);
+  const uint8_t* from = reinterpret_cast<const uint8_t*>(source);
+  for (KInt index = 0; index < count; ++index) {
+    typename Word::Type word;
+    memcpy(&word, from + index * sizeof(T), sizeof(T));
+    word = Word::swap(word);
+    memcpy(to + index * sizeof(T), &word, sizeof(T));
+  }
+}
+
+// Checks `count` elements of size `elementSize` starting at `byteIndex` in the byte array, and `count` elements starting
+// at `index` in the typed array at once. 64-bit arithmetic so that `count * elementSize` cannot overflow.
+ALWAYS_INLINE inline void bulkBoundsCheck(const ArrayHeader* bytes, KInt byteIndex,
+                                          const ArrayHeader* typed, KInt index, KInt count, size_t elementSize) {
+  if (count < 0 || byteIndex < 0 || index < 0 ||
+      static_cast<uint64_t>(count) * elementSize + static_cast<uint64_t>(byteIndex) > bytes->count_ ||
+      static_cast<uint64_t>(count) + static_cast<uint64_t>(index) > typed->count_) {
+    ThrowArrayIndexOutOfBoundsException();
+  }
+}
+
+template<typename T>
+inline void bulkGetImpl(KConstRef thiz, KInt byteIndex, KRef destination, KInt destinationIndex, KInt count,
+                        KBoolean bigEndian) {
+  const ArrayHeader* array = thiz->array();
+  ArrayHeader* destinationArray = destination->array();
+  bulkBoundsCheck(array, byteIndex, destinationArray, destinationIndex, count, sizeof(T));
+  mutabilityCheck(destination);
+  copyPrimitives<T>(PrimitiveArrayAddressOfElementAt<T>(destinationArray, destinationIndex),
+                    ByteArrayAddressOfElementAt(array, byteIndex), count, bigEndian != kHostBigEndian);
+}
+
+template<typename T>
+inline void bulkSetImpl(KRef thiz, KInt byteIndex, KConstRef source, KInt sourceIndex, KInt count,
+                        KBoolean bigEndian) {
+  ArrayHeader* array = thiz->array();
+  const ArrayHeader* sourceArray = source->array();
+  bulkBoundsCheck(array, byteIndex, sourceArray, sourceIndex, count, sizeof(T));
+  mutabilityCheck(thiz);
+  copyPrimitives<T>(ByteArrayAddressOfElementAt(array, byteIndex),
+                    PrimitiveArrayAddressOfElementAt<T>(sourceArray, sourceIndex), count, bigEndian != kHostBigEndian);
+}
+
 }  // namespace
 
 extern "C" {
@@ -443,6 +659,66 @@ void Kotlin_ByteArray_setDoubleAt(KRef thiz, KInt index, KDouble value) {
 #endif  // KONAN_NO_UNALIGNED_ACCESS
 }
 
+void Kotlin_ByteArray_getCharsAt(KConstRef thiz, KInt byteIndex, KRef destination, KInt destinationIndex, KInt count,
+                                 KBoolean bigEndian) {
+  bulkGetImpl<KChar>(thiz, byteIndex, destination, destinationIndex, count, bigEndian);
+}
+
+void Kotlin_ByteArray_getShortsAt(KConstRef thiz, KInt byteIndex, KRef destination, KInt destinationIndex, KInt count,
+                                  KBoolean bigEndian) {
+  bulkGetImpl<KShort>(thiz, byteIndex, destination, destinationIndex, count, bigEndian);
+}
+
+void Kotlin_ByteArray_getIntsAt(KConstRef thiz, KInt byteIndex, KRef destination, KInt destinationIndex, KInt count,
+                                KBoolean bigEndian) {
+  bulkGetImpl<KInt>(thiz, byteIndex, destination, destinationIndex, count, bigEndian);
+}
+
+void Kotlin_ByteArray_getLongsAt(KConstRef thiz, KInt byteIndex, KRef destination, KInt destinationIndex, KInt count,
+                                 KBoolean bigEndian) {
+  bulkGetImpl<KLong>(thiz, byteIndex, destination, destinationIndex, count, bigEndian);
+}
+
+void Kotlin_ByteArray_getFloatsAt(KConstRef thiz, KInt byteIndex, KRef destination, KInt destinationIndex, KInt count,
+                                  KBoolean bigEndian) {
+  bulkGetImpl<KFloat>(thiz, byteIndex, destination, destinationIndex, count, bigEndian);
+}
+
+void Kotlin_ByteArray_getDoublesAt(KConstRef thiz, KInt byteIndex, KRef destination, KInt destinationIndex, KInt count,
+                                   KBoolean bigEndian) {
+  bulkGetImpl<KDouble>(thiz, byteIndex, destination, destinationIndex, count, bigEndian);
+}
+
+void Kotlin_ByteArray_setCharsAt(KRef thiz, KInt byteIndex, KConstRef source, KInt sourceIndex, KInt count,
+                                 KBoolean bigEndian) {
+  bulkSetImpl<KChar>(thiz, byteIndex, source, sourceIndex, count, bigEndian);
+}
+
+void Kotlin_ByteArray_setShortsAt(KRef thiz, KInt byteIndex, KConstRef source, KInt sourceIndex, KInt count,
+                                  KBoolean bigEndian) {
+  bulkSetImpl<KShort>(thiz, byteIndex, source, sourceIndex, count, bigEndian);
+}
+
+void Kotlin_ByteArray_setIntsAt(KRef thiz, KInt byteIndex, KConstRef source, KInt sourceIndex, KInt count,
+                                KBoolean bigEndian) {
+  bulkSetImpl<KInt>(thiz, byteIndex, source, sourceIndex, count, bigEndian);
+}
+
+void Kotlin_ByteArray_setLongsAt(KRef thiz, KInt byteIndex, KConstRef source, KInt sourceIndex, KInt count,
+                                 KBoolean bigEndian) {
+  bulkSetImpl<KLong>(thiz, byteIndex, source, sourceIndex, count, bigEndian);
+}
+
+void Kotlin_ByteArray_setFloatsAt(KRef thiz, KInt byteIndex, KConstRef source, KInt sourceIndex, KInt count,
+                                  KBoolean bigEndian) {
+  bulkSetImpl<KFloat>(thiz, byteIndex, source, sourceIndex, count, bigEndian);
+}
+
+void Kotlin_ByteArray_setDoublesAt(KRef thiz, KInt byteIndex, KConstRef source, KInt sourceIndex, KInt count,
+                                   KBoolean bigEndian) {
+  bulkSetImpl<KDouble>(thiz, byteIndex, source, sourceIndex, count, bigEndian);
+}
+
 KChar Kotlin_CharArray_get(KConstRef thiz, KInt index) {
   return PrimitiveArrayGet<KChar>(thiz, index);
 }
@@ -568,6 +844,118 @@ void Kotlin_BooleanArray_copyImpl(KConstRef thiz, KInt fromIndex,
   copyImpl<KBoolean>(thiz, fromIndex, destination, toIndex, count);
 }
 
+void Kotlin_IntArray_sortImpl(KRef thiz, KInt fromIndex, KInt toIndex) {
+  sortImpl<KInt>(thiz, fromIndex, toIndex);
+}
+
+void Kotlin_LongArray_sortImpl(KRef thiz, KInt fromIndex, KInt toIndex) {
+  sortImpl<KLong>(thiz, fromIndex, toIndex);
+}
+
+void Kotlin_FloatArray_sortImpl(KRef thiz, KInt fromIndex, KInt toIndex) {
+  sortImpl<KFloat>(thiz, fromIndex, toIndex);
+}
+
+void Kotlin_DoubleArray_sortImpl(KRef thiz, KInt fromIndex, KInt toIndex) {
+  sortImpl<KDouble>(thiz, fromIndex, toIndex);
+}
+
+KBoolean Konan_Platform_getParallelArraySorting() {
+  return g_parallelArraySorting;
+}
+
+void Konan_Platform_setParallelArraySorting(KBoolean value) {
+  g_parallelArraySorting = value;
+}
+
+KBoolean Kotlin_ByteArray_contentEquals(KConstRef thiz, KConstRef other) {
+  return contentEqualsImpl<KByte>(thiz, other);
+}
+
+KBoolean Kotlin_ShortArray_contentEquals(KConstRef thiz, KConstRef other) {
+  return contentEqualsImpl<KShort>(thiz, other);
+}
+
+KBoolean Kotlin_CharArray_contentEquals(KConstRef thiz, KConstRef other) {
+  return contentEqualsImpl<KChar>(thiz, other);
+}
+
+KBoolean Kotlin_IntArray_contentEquals(KConstRef thiz, KConstRef other) {
+  return contentEqualsImpl<KInt>(thiz, other);
+}
+
+KBoolean Kotlin_LongArray_contentEquals(KConstRef thiz, KConstRef other) {
+  return contentEqualsImpl<KLong>(thiz, other);
+}
+
+KBoolean Kotlin_BooleanArray_contentEquals(KConstRef thiz, KConstRef other) {
+  return contentEqualsImpl<KBoolean>(thiz, other);
+}
+
+KInt Kotlin_ByteArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KByte>(thiz);
+}
+
+KInt Kotlin_ShortArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KShort>(thiz);
+}
+
+KInt Kotlin_CharArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KChar>(thiz);
+}
+
+KInt Kotlin_IntArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KInt>(thiz);
+}
+
+KInt Kotlin_LongArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KLong>(thiz);
+}
+
+KInt Kotlin_FloatArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KFloat>(thiz);
+}
+
+KInt Kotlin_DoubleArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KDouble>(thiz);
+}
+
+KInt Kotlin_BooleanArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KBoolean>(thiz);
+}
+
+KInt Kotlin_ByteArray_indexOf(KConstRef thiz, KByte element) {
+  return indexOfImpl<KByte>(thiz, element);
+}
+
+KInt Kotlin_ByteArray_lastIndexOf(KConstRef thiz, KByte element) {
+  return lastIndexOfImpl<KByte>(thiz, element);
+}
+
+KInt Kotlin_CharArray_indexOf(KConstRef thiz, KChar element) {
+  return indexOfImpl<KChar>(thiz, element);
+}
+
+KInt Kotlin_CharArray_lastIndexOf(KConstRef thiz, KChar element) {
+  return lastIndexOfImpl<KChar>(thiz, element);
+}
+
+KInt Kotlin_IntArray_indexOf(KConstRef thiz, KInt element) {
+  return indexOfImpl<KInt>(thiz, element);
+}
+
+KInt Kotlin_IntArray_lastIndexOf(KConstRef thiz, KInt element) {
+  return lastIndexOfImpl<KInt>(thiz, element);
+}
+
+KInt Kotlin_LongArray_indexOf(KConstRef thiz, KLong element) {
+  return indexOfImpl<KLong>(thiz, element);
+}
+
+KInt Kotlin_LongArray_lastIndexOf(KConstRef thiz, KLong element) {
+  return lastIndexOfImpl<KLong>(thiz, element);
+}
+
 KLong Kotlin_LongArray_get(KConstRef thiz, KInt index) {
   return PrimitiveArrayGet<KLong>(thiz, index);
 }
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_CHAR_PROPERTIES_H
+#define RUNTIME_CHAR_PROPERTIES_H
+
+#include <cstdint>
+
+#include "Types.h"
+
+namespace kotlin {
+
+struct CharProperties {
+    // Value of kotlin.text.CharCategory.
+    uint8_t category;
+    bool whitespace;
+    // Value of the char as a digit in radix 36, -1 if it is none.
+    int8_t digit;
+    int32_t lowercaseDelta;
+    int32_t uppercaseDelta;
+    int32_t titlecaseDelta;
+};
+
+} // namespace kotlin
+
+#include "CharPropertiesTables.h"
+
+namespace kotlin {
+
+namespace char_category {
+
+// Values of kotlin.text.CharCategory used by the runtime.
+constexpr uint8_t kUnassigned = 0;
+constexpr uint8_t kUppercaseLetter = 1;
+constexpr uint8_t kLowercaseLetter = 2;
+constexpr uint8_t kTitlecaseLetter = 3;
+constexpr uint8_t kOtherLetter = 5;
+constexpr uint8_t kDecimalDigitNumber = 9;
+constexpr uint8_t kFormat = 16;
+
+} // namespace char_category
+
+// Properties of `ch` from a two-stage table: 64-char blocks with equal contents are stored once.
+inline const CharProperties& CharPropertiesOf(KChar ch) noexcept {
+    uint16_t index = internal::kCharBlocks[internal::kCharBlockIndices[ch >> internal::kCharBlockShift]]
+                                          [ch & ((1u << internal::kCharBlockShift) - 1)];
+    return internal::kCharProperties[index];
+}
+
+inline bool IsLetterCategory(uint8_t category) noexcept {
+    return category >= char_category::kUppercaseLetter && category <= char_category::kOtherLetter;
+}
+
+} // namespace kotlin
+
+#endif // RUNTIME_CHAR_PROPERTIES_H
@@ -0,0 +1,1191 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+//
+// NOTE: THIS FILE IS AUTO-GENERATED by tools/scripts/generate_char_tables.py
+//
+
+#ifndef RUNTIME_CHAR_PROPERTIES_TABLES_H
+#define RUNTIME_CHAR_PROPERTIES_TABLES_H
+
+#include <cstdint>
+
+namespace kotlin {
+namespace internal {
+
+constexpr uint32_t kCharBlockShift = 6;
+
+// {category, whitespace, digit, lowercase delta, uppercase delta, titlecase delta}.
+constexpr CharProperties kCharProperties[] = {
+    {15, 0, -1, 0, 0, 0},
+    {15, 1, -1, 0, 0, 0},
+    {12, 1, -1, 0, 0, 0},
+    {24, 0, -1, 0, 0, 0},
+    {26, 0, -1, 0, 0, 0},
+    {21, 0, -1, 0, 0, 0},
+    {22, 0, -1, 0, 0, 0},
+    {25, 0, -1, 0, 0, 0},
+    {20, 0, -1, 0, 0, 0},
+    {9, 0, 0, 0, 0, 0},
+    {9, 0, 1, 0, 0, 0},
+    {9, 0, 2, 0, 0, 0},
+    {9, 0, 3, 0, 0, 0},
+    {9, 0, 4, 0, 0, 0},
+    {9, 0, 5, 0, 0, 0},
+    {9, 0, 6, 0, 0, 0},
+    {9, 0, 7, 0, 0, 0},
+    {9, 0, 8, 0, 0, 0},
+    {9, 0, 9, 0, 0, 0},
+    {1, 0, 10, 32, 0, 0},
+    {1, 0, 11, 32, 0, 0},
+    {1, 0, 12, 32, 0, 0},
+    {1, 0, 13, 32, 0, 0},
+    {1, 0, 14, 32, 0, 0},
+    {1, 0, 15, 32, 0, 0},
+    {1, 0, 16, 32, 0, 0},
+    {1, 0, 17, 32, 0, 0},
+    {1, 0, 18, 32, 0, 0},
+    {1, 0, 19, 32, 0, 0},
+    {1, 0, 20, 32, 0, 0},
+    {1, 0, 21, 32, 0, 0},
+    {1, 0, 22, 32, 0, 0},
+    {1, 0, 23, 32, 0, 0},
+    {1, 0, 24, 32, 0, 0},
+    {1, 0, 25, 32, 0, 0},
+    {1, 0, 26, 32, 0, 0},
+    {1, 0, 27, 32, 0, 0},
+    {1, 0, 28, 32, 0, 0},
+    {1, 0, 29, 32, 0, 0},
+    {1, 0, 30, 32, 0, 0},
+    {1, 0, 31, 32, 0, 0},
+    {1, 0, 32, 32, 0, 0},
+    {1, 0, 33, 32, 0, 0},
+    {1, 0, 34, 32, 0, 0},
+    {1, 0, 35, 32, 0, 0},
+    {27, 0, -1, 0, 0, 0},
+    {23, 0, -1, 0, 0, 0},
+    {2, 0, 10, 0, -32, -32},
+    {2, 0, 11, 0, -32, -32},
+    {2, 0, 12, 0, -32, -32},
+    {2, 0, 13, 0, -32, -32},
+    {2, 0, 14, 0, -32, -32},
+    {2, 0, 15, 0, -32, -32},
+    {2, 0, 16, 0, -32, -32},
+    {2, 0, 17, 0, -32, -32},
+    {2, 0, 18, 0, -32, -32},
+    {2, 0, 19, 0, -32, -32},
+    {2, 0, 20, 0, -32, -32},
+    {2, 0, 21, 0, -32, -32},
+    {2, 0, 22, 0, -32, -32},
+    {2, 0, 23, 0, -32, -32},
+    {2, 0, 24, 0, -32, -32},
+    {2, 0, 25, 0, -32, -32},
+    {2, 0, 26, 0, -32, -32},
+    {2, 0, 27, 0, -32, -32},
+    {2, 0, 28, 0, -32, -32},
+    {2, 0, 29, 0, -32, -32},
+    {2, 0, 30, 0, -32, -32},
+    {2, 0, 31, 0, -32, -32},
+    {2, 0, 32, 0, -32, -32},
+    {2, 0, 33, 0, -32, -32},
+    {2, 0, 34, 0, -32, -32},
+    {2, 0, 35, 0, -32, -32},
+    {28, 0, -1, 0, 0, 0},
+    {5, 0, -1, 0, 0, 0},
+    {29, 0, -1, 0, 0, 0},
+    {16, 0, -1, 0, 0, 0},
+    {11, 0, -1, 0, 0, 0},
+    {2, 0, -1, 0, 743, 743},
+    {30, 0, -1, 0, 0, 0},
+    {1, 0, -1, 32, 0, 0},
+    {2, 0, -1, 0, 0, 0},
+    {2, 0, -1, 0, -32, -32},
+    {2, 0, -1, 0, 121, 121},
+    {1, 0, -1, 1, 0, 0},
+    {2, 0, -1, 0, -1, -1},
+    {1, 0, -1, -199, 0, 0},
+    {2, 0, -1, 0, -232, -232},
+    {1, 0, -1, -121, 0, 0},
+    {2, 0, -1, 0, -300, -300},
+    {2, 0, -1, 0, 195, 195},
+    {1, 0, -1, 210, 0, 0},
+    {1, 0, -1, 206, 0, 0},
+    {1, 0, -1, 205, 0, 0},
+    {1, 0, -1, 79, 0, 0},
+    {1, 0, -1, 202, 0, 0},
+    {1, 0, -1, 203, 0, 0},
+    {1, 0, -1, 207, 0, 0},
+    {2, 0, -1, 0, 97, 97},
+    {1, 0, -1, 211, 0, 0},
+    {1, 0, -1, 209, 0, 0},
+    {2, 0, -1, 0, 163, 163},
+    {1, 0, -1, 213, 0, 0},
+    {2, 0, -1, 0, 130, 130},
+    {1, 0, -1, 214, 0, 0},
+    {1, 0, -1, 218, 0, 0},
+    {1, 0, -1, 217, 0, 0},
+    {1, 0, -1, 219, 0, 0},
+    {2, 0, -1, 0, 56, 56},
+    {1, 0, -1, 2, 0, 1},
+    {3, 0, -1, 1, -1, 0},
+    {2, 0, -1, 0, -2, -1},
+    {2, 0, -1, 0, -79, -79},
+    {1, 0, -1, -97, 0, 0},
+    {1, 0, -1, -56, 0, 0},
+    {1, 0, -1, -130, 0, 0},
+    {1, 0, -1, 10795, 0, 0},
+    {1, 0, -1, -163, 0, 0},
+    {1, 0, -1, 10792, 0, 0},
+    {2, 0, -1, 0, 10815, 10815},
+    {1, 0, -1, -195, 0, 0},
+    {1, 0, -1, 69, 0, 0},
+    {1, 0, -1, 71, 0, 0},
+    {2, 0, -1, 0, 10783, 10783},
+    {2, 0, -1, 0, 10780, 10780},
+    {2, 0, -1, 0, 10782, 10782},
+    {2, 0, -1, 0, -210, -210},
+    {2, 0, -1, 0, -206, -206},
+    {2, 0, -1, 0, -205, -205},
+    {2, 0, -1, 0, -202, -202},
+    {2, 0, -1, 0, -203, -203},
+    {2, 0, -1, 0, 42319, 42319},
+    {2, 0, -1, 0, 42315, 42315},
+    {2, 0, -1, 0, -207, -207},
+    {2, 0, -1, 0, 42280, 42280},
+    {2, 0, -1, 0, 42308, 42308},
+    {2, 0, -1, 0, -209, -209},
+    {2, 0, -1, 0, -211, -211},
+    {2, 0, -1, 0, 10743, 10743},
+    {2, 0, -1, 0, 42305, 42305},
+    {2, 0, -1, 0, 10749, 10749},
+    {2, 0, -1, 0, -213, -213},
+    {2, 0, -1, 0, -214, -214},
+    {2, 0, -1, 0, 10727, 10727},
+    {2, 0, -1, 0, -218, -218},
+    {2, 0, -1, 0, 42307, 42307},
+    {2, 0, -1, 0, 42282, 42282},
+    {2, 0, -1, 0, -69, -69},
+    {2, 0, -1, 0, -217, -217},
+    {2, 0, -1, 0, -71, -71},
+    {2, 0, -1, 0, -219, -219},
+    {2, 0, -1, 0, 42261, 42261},
+    {2, 0, -1, 0, 42258, 42258},
+    {4, 0, -1, 0, 0, 0},
+    {6, 0, -1, 0, 0, 0},
+    {6, 0, -1, 0, 84, 84},
+    {0, 0, -1, 0, 0, 0},
+    {1, 0, -1, 116, 0, 0},
+    {1, 0, -1, 38, 0, 0},
+    {1, 0, -1, 37, 0, 0},
+    {1, 0, -1, 64, 0, 0},
+    {1, 0, -1, 63, 0, 0},
+    {2, 0, -1, 0, -38, -38},
+    {2, 0, -1, 0, -37, -37},
+    {2, 0, -1, 0, -31, -31},
+    {2, 0, -1, 0, -64, -64},
+    {2, 0, -1, 0, -63, -63},
+    {1, 0, -1, 8, 0, 0},
+    {2, 0, -1, 0, -62, -62},
+    {2, 0, -1, 0, -57, -57},
+    {1, 0, -1, 0, 0, 0},
+    {2, 0, -1, 0, -47, -47},
+    {2, 0, -1, 0, -54, -54},
+    {2, 0, -1, 0, -8, -8},
+    {2, 0, -1, 0, -86, -86},
+    {2, 0, -1, 0, -80, -80},
+    {2, 0, -1, 0, 7, 7},
+    {2, 0, -1, 0, -116, -116},
+    {1, 0, -1, -60, 0, 0},
+    {2, 0, -1, 0, -96, -96},
+    {1, 0, -1, -7, 0, 0},
+    {1, 0, -1, 80, 0, 0},
+    {7, 0, -1, 0, 0, 0},
+    {1, 0, -1, 15, 0, 0},
+    {2, 0, -1, 0, -15, -15},
+    {1, 0, -1, 48, 0, 0},
+    {2, 0, -1, 0, -48, -48},
+    {9, 0, -1, 0, 0, 0},
+    {8, 0, -1, 0, 0, 0},
+    {1, 0, -1, 7264, 0, 0},
+    {2, 0, -1, 0, 3008, 0},
+    {11, 0, 1, 0, 0, 0},
+    {11, 0, 2, 0, 0, 0},
+    {11, 0, 3, 0, 0, 0},
+    {11, 0, 4, 0, 0, 0},
+    {11, 0, 5, 0, 0, 0},
+    {11, 0, 6, 0, 0, 0},
+    {11, 0, 7, 0, 0, 0},
+    {11, 0, 8, 0, 0, 0},
+    {11, 0, 9, 0, 0, 0},
+    {1, 0, -1, 38864, 0, 0},
+    {10, 0, -1, 0, 0, 0},
+    {2, 0, -1, 0, -6254, -6254},
+    {2, 0, -1, 0, -6253, -6253},
+    {2, 0, -1, 0, -6244, -6244},
+    {2, 0, -1, 0, -6242, -6242},
+    {2, 0, -1, 0, -6243, -6243},
+    {2, 0, -1, 0, -6236, -6236},
+    {2, 0, -1, 0, -6181, -6181},
+    {2, 0, -1, 0, 35266, 35266},
+    {1, 0, -1, -3008, 0, 0},
+    {2, 0, -1, 0, 35332, 35332},
+    {2, 0, -1, 0, 3814, 3814},
+    {2, 0, -1, 0, 35384, 35384},
+    {2, 0, -1, 0, -59, -59},
+    {1, 0, -1, -7615, 0, 0},
+    {2, 0, -1, 0, 8, 8},
+    {1, 0, -1, -8, 0, 0},
+    {2, 0, -1, 0, 74, 74},
+    {2, 0, -1, 0, 86, 86},
+    {2, 0, -1, 0, 100, 100},
+    {2, 0, -1, 0, 128, 128},
+    {2, 0, -1, 0, 112, 112},
+    {2, 0, -1, 0, 126, 126},
+    {3, 0, -1, -8, 0, 0},
+    {2, 0, -1, 0, 9, 9},
+    {1, 0, -1, -74, 0, 0},
+    {3, 0, -1, -9, 0, 0},
+    {2, 0, -1, 0, -7205, -7205},
+    {1, 0, -1, -86, 0, 0},
+    {1, 0, -1, -100, 0, 0},
+    {1, 0, -1, -112, 0, 0},
+    {1, 0, -1, -128, 0, 0},
+    {1, 0, -1, -126, 0, 0},
+    {13, 1, -1, 0, 0, 0},
+    {14, 1, -1, 0, 0, 0},
+    {1, 0, -1, -7517, 0, 0},
+    {1, 0, -1, -8383, 0, 0},
+    {1, 0, -1, -8262, 0, 0},
+    {1, 0, -1, 28, 0, 0},
+    {2, 0, -1, 0, -28, -28},
+    {10, 0, -1, 16, 0, 0},
+    {10, 0, -1, 0, -16, -16},
+    {28, 0, -1, 26, 0, 0},
+    {28, 0, -1, 0, -26, -26},
+    {1, 0, -1, -10743, 0, 0},
+    {1, 0, -1, -3814, 0, 0},
+    {1, 0, -1, -10727, 0, 0},
+    {2, 0, -1, 0, -10795, -10795},
+    {2, 0, -1, 0, -10792, -10792},
+    {1, 0, -1, -10780, 0, 0},
+    {1, 0, -1, -10749, 0, 0},
+    {1, 0, -1, -10783, 0, 0},
+    {1, 0, -1, -10782, 0, 0},
+    {1, 0, -1, -10815, 0, 0},
+    {2, 0, -1, 0, -7264, -7264},
+    {1, 0, -1, -35332, 0, 0},
+    {1, 0, -1, -42280, 0, 0},
+    {2, 0, -1, 0, 48, 48},
+    {1, 0, -1, -42308, 0, 0},
+    {1, 0, -1, -42319, 0, 0},
+    {1, 0, -1, -42315, 0, 0},
+    {1, 0, -1, -42305, 0, 0},
+    {1, 0, -1, -42258, 0, 0},
+    {1, 0, -1, -42282, 0, 0},
+    {1, 0, -1, -42261, 0, 0},
+    {1, 0, -1, 928, 0, 0},
+    {1, 0, -1, -48, 0, 0},
+    {1, 0, -1, -42307, 0, 0},
+    {1, 0, -1, -35384, 0, 0},
+    {2, 0, -1, 0, -928, -928},
+    {2, 0, -1, 0, -38864, -38864},
+    {19, 0, -1, 0, 0, 0},
+    {18, 0, -1, 0, 0, 0},
+};
+
+constexpr uint8_t kCharBlockIndices[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 26, 26, 26, 26, 26, 68, 69, 70, 71, 72, 73, 74, 75, 26, 26, 26, 26, 26, 26, 26, 26, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 107, 108, 107, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 121, 121, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 130, 131, 132, 130, 133, 130, 130, 130, 134, 135, 136,
+    130, 130, 130, 130, 121, 121, 137, 138, 121, 121, 121, 121, 139, 140, 141, 130, 142, 143, 107, 144, 145, 146, 147, 148, 149, 150, 151, 152, 130, 130, 130, 153,
+    154, 155, 156, 157, 158, 26, 159, 160, 161, 162, 163, 130, 130, 130, 130, 130, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 130, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 164,
+    165, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 166, 167, 26, 26, 26, 26, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 192, 193,
+    194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 26, 26, 26, 26, 26, 196, 26, 197, 198, 199, 200, 201, 26, 26, 26, 26, 202, 203, 204, 205, 206, 207, 26, 208, 209, 210, 211, 212,
+};
+
+constexpr uint16_t kCharBlocks[][64] = {
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+        2, 3, 3, 3, 4, 3, 3, 3, 5, 6, 3, 7, 3, 8, 3, 3, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 3, 3, 7, 7, 7, 3,
+    },
+    {
+        3, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 5, 3, 6, 45, 46,
+        45, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 5, 7, 6, 7, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2, 3, 4, 4, 4, 4, 73, 3, 45, 73, 74, 75, 7, 76, 73, 45, 73, 7, 77, 77, 45, 78, 3, 3, 45, 77, 74, 79, 77, 77, 77, 3,
+    },
+    {
+        80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 7, 80, 80, 80, 80, 80, 80, 80, 81,
+        82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 7, 82, 82, 82, 82, 82, 82, 82, 83,
+    },
+    {
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 86, 87, 84, 85, 84, 85, 84, 85, 81, 84, 85, 84, 85, 84, 85, 84,
+    },
+    {
+        85, 84, 85, 84, 85, 84, 85, 84, 85, 81, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 88, 84, 85, 84, 85, 84, 85, 89,
+    },
+    {
+        90, 91, 84, 85, 84, 85, 92, 84, 85, 93, 93, 84, 85, 81, 94, 95, 96, 84, 85, 93, 97, 98, 99, 100, 84, 85, 101, 81, 99, 102, 103, 104,
+        84, 85, 84, 85, 84, 85, 105, 84, 85, 105, 81, 81, 84, 85, 105, 84, 85, 106, 106, 84, 85, 84, 85, 107, 84, 85, 81, 74, 84, 85, 81, 108,
+    },
+    {
+        74, 74, 74, 74, 109, 110, 111, 109, 110, 111, 109, 110, 111, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 112, 84, 85,
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 81, 109, 110, 111, 84, 85, 113, 114, 84, 85, 84, 85, 84, 85, 84, 85,
+    },
+    {
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+        115, 81, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 81, 81, 81, 81, 81, 81, 116, 84, 85, 117, 118, 119,
+    },
+    {
+        119, 84, 85, 120, 121, 122, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 123, 124, 125, 126, 127, 81, 128, 128, 81, 129, 81, 130, 131, 81, 81, 81,
+        128, 132, 81, 133, 81, 134, 135, 81, 136, 137, 135, 138, 139, 81, 81, 137, 81, 140, 141, 81, 81, 142, 81, 81, 81, 81, 81, 81, 81, 143, 81, 81,
+    },
+    {
+        144, 81, 145, 144, 81, 81, 81, 146, 144, 147, 148, 148, 149, 81, 81, 81, 81, 81, 150, 81, 74, 81, 81, 81, 81, 81, 81, 81, 81, 151, 152, 81,
+        81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+    },
+    {
+        153, 153, 45, 45, 45, 45, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+        153, 153, 153, 153, 153, 45, 45, 45, 45, 45, 45, 45, 153, 45, 153, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+    },
+    {
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    },
+    {
+        154, 154, 154, 154, 154, 155, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 84, 85, 84, 85, 153, 45, 84, 85, 156, 156, 153, 103, 103, 103, 3, 157,
+    },
+    {
+        156, 156, 156, 156, 45, 45, 158, 3, 159, 159, 159, 156, 160, 156, 161, 161, 81, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+        80, 80, 156, 80, 80, 80, 80, 80, 80, 80, 80, 80, 162, 163, 163, 163, 81, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    },
+    {
+        82, 82, 164, 82, 82, 82, 82, 82, 82, 82, 82, 82, 165, 166, 166, 167, 168, 169, 170, 170, 170, 171, 172, 173, 84, 85, 84, 85, 84, 85, 84, 85,
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 174, 175, 176, 177, 178, 179, 7, 84, 85, 180, 84, 85, 81, 115, 115, 115,
+    },
+    {
+        181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+        80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    },
+    {
+        82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+    },
+    {
+        84, 85, 73, 154, 154, 154, 154, 154, 182, 182, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+    },
+    {
+        183, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 184, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+    },
+    {
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 156, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185,
+    },
+    {
+        185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 156, 156, 153, 3, 3, 3, 3, 3, 3,
+        81, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    },
+    {
+        186, 186, 186, 186, 186, 186, 186, 81, 81, 3, 8, 156, 156, 73, 73, 4, 156, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 8, 154,
+    },
+    {
+        3, 154, 154, 3, 154, 154, 3, 154, 156, 156, 156, 156, 156, 156, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 74, 74, 74, 74, 3, 3, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        76, 76, 76, 76, 76, 76, 7, 7, 7, 3, 3, 4, 3, 3, 73, 73, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 3, 76, 156, 3, 3,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        153, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 3, 3, 3, 3, 74, 74, 154, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 3, 74, 154, 154, 154, 154, 154, 154, 154, 76, 73, 154,
+        154, 154, 154, 154, 154, 153, 153, 154, 154, 73, 154, 154, 154, 154, 74, 74, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 74, 74, 74, 73, 73, 74,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 156, 76, 74, 154, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    },
+    {
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 74, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 154, 154, 154, 154, 154, 154, 154, 154, 153, 153, 73, 3, 3, 3, 153, 156, 156, 154, 4, 4,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 154, 154, 154, 153, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 153, 154, 154, 154, 153, 154, 154, 154, 154, 154, 156, 156, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 154, 154, 156, 156, 3, 156,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 76, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    },
+    {
+        154, 154, 154, 188, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 188, 154, 74, 188, 188,
+    },
+    {
+        188, 154, 154, 154, 154, 154, 154, 154, 154, 188, 188, 188, 188, 154, 188, 188, 74, 154, 154, 154, 154, 154, 154, 154, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 154, 154, 3, 3, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 3, 153, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 154, 188, 188, 156, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 74, 74, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 156, 74, 156, 156, 156, 74, 74, 74, 74, 156, 156, 154, 74, 188, 188,
+    },
+    {
+        188, 154, 154, 154, 154, 156, 156, 188, 188, 156, 156, 188, 188, 154, 74, 156, 156, 156, 156, 156, 156, 156, 156, 188, 156, 156, 156, 156, 74, 74, 156, 74,
+        74, 74, 154, 154, 156, 156, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 74, 74, 4, 4, 77, 77, 77, 77, 77, 77, 73, 4, 74, 3, 154, 156,
+    },
+    {
+        156, 154, 154, 188, 156, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 74, 74, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 156, 74, 74, 156, 74, 74, 156, 156, 154, 156, 188, 188,
+    },
+    {
+        188, 154, 154, 156, 156, 156, 156, 154, 154, 156, 156, 154, 154, 154, 156, 156, 156, 154, 156, 156, 156, 156, 156, 156, 156, 74, 74, 74, 74, 156, 74, 156,
+        156, 156, 156, 156, 156, 156, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 154, 154, 74, 74, 74, 154, 3, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        156, 154, 154, 188, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 156, 74, 74, 74, 74, 74, 156, 156, 154, 74, 188, 188,
+    },
+    {
+        188, 154, 154, 154, 154, 154, 156, 154, 154, 188, 156, 188, 188, 154, 156, 156, 74, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        74, 74, 154, 154, 156, 156, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 3, 4, 156, 156, 156, 156, 156, 156, 156, 74, 154, 154, 154, 154, 154, 154,
+    },
+    {
+        156, 154, 188, 188, 156, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 74, 74, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 156, 74, 74, 74, 74, 74, 156, 156, 154, 74, 188, 154,
+    },
+    {
+        188, 154, 154, 154, 154, 156, 156, 188, 188, 156, 156, 188, 188, 154, 156, 156, 156, 156, 156, 156, 156, 154, 154, 188, 156, 156, 156, 156, 74, 74, 156, 74,
+        74, 74, 154, 154, 156, 156, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 73, 74, 77, 77, 77, 77, 77, 77, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        156, 156, 154, 74, 156, 74, 74, 74, 74, 74, 74, 156, 156, 156, 74, 74, 74, 156, 74, 74, 74, 74, 156, 156, 156, 74, 74, 156, 74, 156, 74, 74,
+        156, 156, 156, 74, 74, 156, 156, 156, 74, 74, 74, 156, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 188, 188,
+    },
+    {
+        154, 188, 188, 156, 156, 156, 188, 188, 188, 156, 188, 188, 188, 154, 156, 156, 74, 156, 156, 156, 156, 156, 156, 188, 156, 156, 156, 156, 156, 156, 156, 156,
+        156, 156, 156, 156, 156, 156, 187, 10, 11, 12, 13, 14, 15, 16, 17, 18, 77, 77, 77, 73, 73, 73, 73, 73, 73, 4, 73, 156, 156, 156, 156, 156,
+    },
+    {
+        154, 188, 188, 188, 154, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 74, 154, 154,
+    },
+    {
+        154, 188, 188, 188, 188, 156, 154, 154, 154, 156, 154, 154, 154, 154, 156, 156, 156, 156, 156, 156, 156, 154, 154, 156, 74, 74, 74, 156, 156, 156, 156, 156,
+        74, 74, 154, 154, 156, 156, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 156, 156, 156, 156, 156, 156, 156, 3, 77, 77, 77, 77, 77, 77, 77, 73,
+    },
+    {
+        74, 154, 188, 188, 3, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 156, 156, 154, 74, 188, 154,
+    },
+    {
+        188, 188, 188, 188, 188, 156, 154, 188, 188, 156, 188, 188, 154, 154, 156, 156, 156, 156, 156, 156, 156, 188, 188, 156, 156, 156, 156, 156, 156, 156, 74, 156,
+        74, 74, 154, 154, 156, 156, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 156, 74, 74, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        154, 154, 188, 188, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 154, 74, 188, 188,
+    },
+    {
+        188, 154, 154, 154, 154, 156, 188, 188, 188, 156, 188, 188, 188, 154, 74, 73, 156, 156, 156, 156, 74, 74, 74, 188, 77, 77, 77, 77, 77, 77, 77, 74,
+        74, 74, 154, 154, 156, 156, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 77, 77, 77, 77, 77, 77, 77, 77, 77, 73, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        156, 154, 188, 188, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 156, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 154, 156, 156, 156, 156, 188, 188, 188, 154, 154, 154, 156, 154, 156, 188, 188, 188, 188, 188, 188, 188, 188,
+        156, 156, 156, 156, 156, 156, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 156, 156, 188, 188, 3, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 74, 74, 154, 154, 154, 154, 154, 154, 154, 156, 156, 156, 156, 4,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 153, 154, 154, 154, 154, 154, 154, 154, 154, 3, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 3, 3, 156, 156, 156, 156,
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        156, 74, 74, 156, 74, 156, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 156, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 74, 74, 154, 154, 154, 154, 154, 154, 154, 154, 154, 74, 156, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 156, 153, 156, 154, 154, 154, 154, 154, 154, 156, 156, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 156, 156, 74, 74, 74, 74,
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        74, 73, 73, 73, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 73, 3, 73, 73, 73, 154, 154, 73, 73, 73, 73, 73, 73,
+        9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 73, 154, 73, 154, 73, 154, 5, 6, 5, 6, 188, 188,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 188,
+    },
+    {
+        154, 154, 154, 154, 154, 3, 154, 154, 74, 74, 74, 74, 74, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 156, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 156, 73, 73,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 154, 73, 73, 73, 73, 73, 73, 156, 73, 73, 3, 3, 3, 3, 3, 73, 73, 73, 73, 3, 3, 156, 156, 156, 156, 156,
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 188, 188, 154, 154, 154, 154, 188, 154, 154, 154, 154, 154, 154, 188, 154, 154, 188, 188, 154, 154, 74,
+    },
+    {
+        9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 3, 3, 3, 3, 3, 3, 74, 74, 74, 74, 74, 74, 188, 188, 154, 154, 74, 74, 74, 74, 154, 154,
+        154, 74, 188, 188, 188, 74, 74, 188, 188, 188, 188, 188, 188, 188, 74, 74, 74, 154, 154, 154, 154, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 154, 188, 188, 154, 154, 188, 188, 188, 188, 188, 188, 154, 74, 188, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 188, 188, 188, 154, 73, 73,
+        189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 189,
+    },
+    {
+        189, 189, 189, 189, 189, 189, 156, 189, 156, 156, 156, 156, 156, 189, 156, 156, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+        190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 3, 153, 190, 190, 190,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 156, 156, 74, 74, 74, 74, 74, 74, 74, 156, 74, 156, 74, 74, 74, 74, 156, 156,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 156, 156, 74, 74, 74, 74, 74, 74, 74, 156,
+    },
+    {
+        74, 156, 74, 74, 74, 74, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 154, 154, 154,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 191, 192, 193, 194, 195, 196, 197, 198, 199, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 156, 156, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 156, 156, 156, 156, 156, 156,
+        200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200,
+    },
+    {
+        200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200,
+        200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 167, 167, 167, 167, 167, 167, 156, 156, 173, 173, 173, 173, 173, 173, 156, 156,
+    },
+    {
+        8, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 73, 3, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        2, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 5, 6, 156, 156, 156,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 3, 3, 3, 201, 201, 201, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 154, 154, 154, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 154, 154, 3, 3, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 154, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 156, 154, 154, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 154, 188, 154, 154, 154, 154, 154, 154, 154, 188, 188,
+    },
+    {
+        188, 188, 188, 188, 188, 188, 154, 188, 188, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 3, 3, 3, 153, 3, 3, 3, 4, 74, 154, 156, 156,
+        9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 156, 156, 156, 156, 156, 156, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 8, 3, 3, 3, 3, 154, 154, 154, 76, 156, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 156, 156, 156, 156, 156, 156,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 153, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 154, 154, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 74, 156, 156, 156, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156,
+        154, 154, 154, 188, 188, 188, 188, 154, 154, 188, 188, 188, 156, 156, 156, 156, 188, 188, 154, 188, 188, 188, 188, 188, 188, 154, 154, 154, 156, 156, 156, 156,
+    },
+    {
+        73, 156, 156, 156, 3, 3, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 74, 74, 74, 74, 74, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 156, 156, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 77, 156, 156, 156, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 154, 188, 188, 154, 156, 156, 3, 3,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 188, 154, 188, 154, 154, 154, 154, 154, 154, 154, 156,
+        154, 188, 154, 188, 188, 154, 154, 154, 154, 154, 154, 154, 154, 188, 188, 188, 188, 188, 188, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 156, 156, 154,
+    },
+    {
+        187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 156, 156, 156, 156, 156, 156, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 156, 156, 156, 156, 156, 156,
+        3, 3, 3, 3, 3, 3, 3, 153, 3, 3, 3, 3, 3, 3, 156, 156, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 182, 154,
+    },
+    {
+        154, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        154, 154, 154, 154, 188, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 188, 154, 154, 154, 154, 154, 188, 154, 188, 188, 188,
+    },
+    {
+        188, 188, 154, 188, 188, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 3, 3, 3, 3, 3, 3,
+        3, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 154, 154, 154, 154, 154, 154, 154, 154, 154, 73, 73, 73, 73, 73, 73, 73, 73, 73, 156, 156, 156,
+    },
+    {
+        154, 154, 188, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 188, 154, 154, 154, 154, 188, 188, 154, 154, 188, 154, 154, 154, 74, 74, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 154, 188, 154, 154, 188, 188, 188, 154, 188, 154, 154, 154, 188, 188, 156, 156, 156, 156, 156, 156, 156, 156, 3, 3, 3, 3,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 188, 188, 188, 188, 188, 188, 188, 188, 154, 154, 154, 154, 154, 154, 154, 154, 188, 188, 154, 154, 156, 156, 156, 3, 3, 3, 3, 3,
+    },
+    {
+        187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 156, 156, 156, 74, 74, 74, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 153, 153, 153, 153, 153, 153, 3, 3,
+    },
+    {
+        202, 203, 204, 205, 205, 206, 207, 208, 209, 156, 156, 156, 156, 156, 156, 156, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+        210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 156, 156, 210, 210, 210,
+    },
+    {
+        3, 3, 3, 3, 3, 3, 3, 3, 156, 156, 156, 156, 156, 156, 156, 156, 154, 154, 154, 3, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 188, 154, 154, 154, 154, 154, 154, 154, 74, 74, 74, 74, 154, 74, 74, 74, 74, 74, 74, 154, 74, 74, 188, 154, 154, 74, 156, 156, 156, 156, 156,
+    },
+    {
+        81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+        81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+    },
+    {
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 153, 211, 81, 81, 81, 212, 81, 81,
+    },
+    {
+        81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 213, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+    },
+    {
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 156, 154, 154, 154, 154, 154,
+    },
+    {
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+    },
+    {
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 81, 81, 81, 81, 81, 214, 81, 81, 215, 81,
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+    },
+    {
+        216, 216, 216, 216, 216, 216, 216, 216, 217, 217, 217, 217, 217, 217, 217, 217, 216, 216, 216, 216, 216, 216, 156, 156, 217, 217, 217, 217, 217, 217, 156, 156,
+        216, 216, 216, 216, 216, 216, 216, 216, 217, 217, 217, 217, 217, 217, 217, 217, 216, 216, 216, 216, 216, 216, 216, 216, 217, 217, 217, 217, 217, 217, 217, 217,
+    },
+    {
+        216, 216, 216, 216, 216, 216, 156, 156, 217, 217, 217, 217, 217, 217, 156, 156, 81, 216, 81, 216, 81, 216, 81, 216, 156, 217, 156, 217, 156, 217, 156, 217,
+        216, 216, 216, 216, 216, 216, 216, 216, 217, 217, 217, 217, 217, 217, 217, 217, 218, 218, 219, 219, 219, 219, 220, 220, 221, 221, 222, 222, 223, 223, 156, 156,
+    },
+    {
+        216, 216, 216, 216, 216, 216, 216, 216, 224, 224, 224, 224, 224, 224, 224, 224, 216, 216, 216, 216, 216, 216, 216, 216, 224, 224, 224, 224, 224, 224, 224, 224,
+        216, 216, 216, 216, 216, 216, 216, 216, 224, 224, 224, 224, 224, 224, 224, 224, 216, 216, 81, 225, 81, 156, 81, 81, 217, 217, 226, 226, 227, 45, 228, 45,
+    },
+    {
+        45, 45, 81, 225, 81, 156, 81, 81, 229, 229, 229, 229, 227, 45, 45, 45, 216, 216, 81, 81, 156, 156, 81, 81, 217, 217, 230, 230, 156, 45, 45, 45,
+        216, 216, 81, 81, 81, 176, 81, 81, 217, 217, 231, 231, 180, 45, 45, 45, 156, 156, 81, 225, 81, 156, 81, 81, 232, 232, 233, 233, 227, 45, 45, 156,
+    },
+    {
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 76, 76, 76, 76, 76, 8, 8, 8, 8, 8, 8, 3, 3, 75, 79, 5, 75, 75, 79, 5, 75,
+        3, 3, 3, 3, 3, 3, 3, 3, 234, 235, 76, 76, 76, 76, 76, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 75, 79, 3, 3, 3, 3, 46,
+    },
+    {
+        46, 3, 3, 3, 7, 5, 6, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 7, 3, 46, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2,
+        76, 76, 76, 76, 76, 156, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 77, 153, 156, 156, 77, 77, 77, 77, 77, 77, 7, 7, 7, 5, 6, 153,
+    },
+    {
+        77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 7, 7, 7, 5, 6, 156, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 156, 156, 156,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    },
+    {
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 182, 182, 182,
+        182, 154, 182, 182, 182, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        73, 73, 170, 73, 73, 73, 73, 170, 73, 73, 81, 170, 170, 170, 81, 81, 170, 170, 170, 81, 73, 170, 73, 73, 7, 170, 170, 170, 170, 170, 73, 73,
+        73, 73, 73, 73, 170, 73, 236, 73, 170, 73, 237, 238, 170, 170, 73, 81, 170, 170, 239, 170, 81, 74, 74, 74, 74, 81, 73, 73, 81, 81, 170, 170,
+    },
+    {
+        7, 7, 7, 7, 7, 170, 81, 81, 81, 81, 73, 7, 73, 73, 240, 73, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+        241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+    },
+    {
+        201, 201, 201, 84, 85, 201, 201, 201, 201, 77, 73, 73, 156, 156, 156, 156, 7, 7, 7, 7, 7, 73, 73, 73, 73, 73, 7, 7, 73, 73, 73, 73,
+        7, 73, 73, 7, 73, 73, 7, 73, 73, 73, 73, 73, 73, 73, 7, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 7, 7, 73, 73, 7, 73, 7, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    },
+    {
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 5, 6, 5, 6, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        7, 7, 73, 73, 73, 73, 73, 73, 73, 5, 6, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 7, 73, 73, 73,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 7, 7, 7, 7,
+        7, 7, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    },
+    {
+        77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+    },
+    {
+        243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+        244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 7, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        73, 7, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 7, 7, 7, 7, 7, 7, 7, 7,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 7, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    },
+    {
+        77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        7, 7, 7, 7, 7, 5, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    },
+    {
+        7, 7, 7, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    },
+    {
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 5, 6, 5, 6, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 5, 6, 7, 7,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    },
+    {
+        7, 7, 7, 7, 7, 73, 73, 7, 7, 7, 7, 7, 7, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 156, 156, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 156, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185,
+        185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 156, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    },
+    {
+        186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 156,
+        84, 85, 245, 246, 247, 248, 249, 84, 85, 84, 85, 84, 85, 250, 251, 252, 253, 81, 84, 85, 81, 84, 85, 81, 81, 81, 81, 81, 153, 153, 254, 254,
+    },
+    {
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+        84, 85, 84, 85, 81, 73, 73, 73, 73, 73, 73, 84, 85, 84, 85, 154, 154, 154, 84, 85, 156, 156, 156, 156, 156, 3, 3, 3, 3, 77, 3, 3,
+    },
+    {
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 156, 255, 156, 156, 156, 156, 156, 255, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 156, 156, 156, 153, 3, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 154,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 156,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+    },
+    {
+        3, 3, 75, 79, 75, 79, 3, 3, 3, 75, 79, 3, 75, 79, 3, 3, 3, 3, 3, 3, 3, 3, 3, 8, 3, 3, 8, 3, 75, 79, 3, 3,
+        75, 79, 5, 6, 5, 6, 5, 6, 5, 6, 3, 3, 3, 3, 3, 153, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 8, 8, 3, 3, 3, 3,
+    },
+    {
+        8, 3, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 73, 73, 3, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 156, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 156, 156, 156, 156,
+    },
+    {
+        2, 3, 3, 3, 73, 153, 74, 201, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 73, 73, 5, 6, 5, 6, 5, 6, 5, 6, 8, 5, 6, 6,
+        73, 201, 201, 201, 201, 201, 201, 201, 201, 201, 154, 154, 154, 154, 188, 188, 8, 153, 153, 153, 153, 153, 73, 73, 201, 201, 201, 153, 74, 3, 73, 73,
+    },
+    {
+        156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 154, 154, 45, 45, 153, 153, 74,
+        8, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 3, 153, 153, 153, 74,
+    },
+    {
+        156, 156, 156, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 73, 73, 77, 77, 77, 77, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 156,
+        77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 77, 77, 77, 77, 77, 77, 77, 77, 73, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 153, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+        73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 156, 156, 156, 156, 156, 156, 156, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 153, 153, 153, 153, 153, 153, 3, 3,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 153, 3, 3, 3, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 74, 74, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 74, 154, 182, 182, 182, 3, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 3, 153,
+    },
+    {
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 153, 153, 154, 154,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201, 154, 154, 3, 3, 3, 3, 3, 3, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        45, 45, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 81, 81, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+    },
+    {
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 153, 81, 81, 81, 81, 81, 81, 81, 81, 84, 85, 84, 85, 256, 84, 85,
+    },
+    {
+        84, 85, 84, 85, 84, 85, 84, 85, 153, 45, 45, 84, 85, 257, 81, 74, 84, 85, 84, 85, 258, 81, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+        84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 259, 260, 261, 262, 259, 81, 263, 264, 265, 266, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85, 84, 85,
+    },
+    {
+        156, 156, 84, 85, 267, 268, 269, 84, 85, 84, 85, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 84, 85, 74, 153, 153, 81, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 154, 74, 74, 74, 154, 74, 74, 74, 74, 154, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 188, 188, 154, 154, 188, 73, 73, 73, 73, 154, 156, 156, 156, 77, 77, 77, 77, 77, 77, 73, 73, 4, 73, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 3, 3, 3, 3, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        188, 188, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188,
+    },
+    {
+        188, 188, 188, 188, 154, 154, 156, 156, 156, 156, 156, 156, 156, 156, 3, 3, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 156, 156, 156, 156, 156, 156,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 74, 74, 74, 74, 74, 74, 3, 3, 3, 74, 3, 74, 74, 154,
+    },
+    {
+        187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 154, 154, 154, 154, 154, 154, 154, 154, 3, 3, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 188, 188, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 3,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156,
+    },
+    {
+        154, 154, 154, 188, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 188, 188, 154, 154, 154, 154, 188, 188, 154, 154, 188, 188,
+    },
+    {
+        188, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 156, 153, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 156, 156, 156, 156, 3, 3,
+        74, 74, 74, 74, 74, 154, 153, 74, 74, 74, 74, 74, 74, 74, 74, 74, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 74, 74, 74, 74, 74, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 154, 154, 154, 154, 154, 188, 188, 154, 154, 188, 188, 154, 154, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        74, 74, 74, 154, 74, 74, 74, 74, 74, 74, 74, 74, 154, 188, 156, 156, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 156, 156, 3, 3, 3, 3,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 153, 74, 74, 74, 74, 74, 74, 73, 73, 73, 74, 188, 154, 188, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 154, 74, 154, 154, 154, 74, 74, 154, 154, 74, 74, 74, 74, 74, 154, 154,
+    },
+    {
+        74, 154, 74, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 74, 74, 153, 3, 3,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 188, 154, 154, 188, 188, 3, 3, 74, 153, 153, 188, 154, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        156, 74, 74, 74, 74, 74, 74, 156, 156, 74, 74, 74, 74, 74, 74, 156, 156, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 156, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    },
+    {
+        81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 270, 81, 81, 81, 81, 81, 81, 81, 45, 153, 153, 153, 153,
+        81, 81, 81, 81, 81, 81, 81, 81, 81, 153, 45, 45, 156, 156, 156, 156, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271,
+    },
+    {
+        271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271,
+        271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 188, 188, 154, 188, 188, 154, 188, 188, 3, 188, 154, 156, 156, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156,
+    },
+    {
+        272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272,
+        272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272, 272,
+    },
+    {
+        273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+        273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 156, 156,
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+    },
+    {
+        81, 81, 81, 81, 81, 81, 81, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 81, 81, 81, 81, 81, 156, 156, 156, 156, 156, 74, 154, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 7, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 156, 74, 156,
+    },
+    {
+        74, 74, 156, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+    },
+    {
+        45, 45, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 6, 5,
+    },
+    {
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 4, 73, 156, 156,
+    },
+    {
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 3, 3, 3, 3, 3, 3, 3, 5, 6, 3, 156, 156, 156, 156, 156, 156,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 3, 8, 8, 46, 46, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+    },
+    {
+        6, 5, 6, 5, 6, 3, 3, 5, 6, 3, 3, 3, 3, 46, 46, 46, 3, 3, 3, 156, 3, 3, 3, 3, 8, 5, 6, 5, 6, 5, 6, 3,
+        3, 3, 7, 8, 7, 7, 7, 156, 3, 4, 3, 3, 156, 156, 156, 156, 74, 74, 74, 74, 74, 156, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156, 156, 76,
+    },
+    {
+        156, 3, 3, 3, 4, 3, 3, 3, 5, 6, 3, 7, 3, 8, 3, 3, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 3, 3, 7, 7, 7, 3,
+        3, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 5, 3, 6, 45, 46,
+    },
+    {
+        45, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 5, 7, 6, 7, 5,
+        6, 3, 5, 6, 3, 3, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 153, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    },
+    {
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 153, 153,
+        74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 156,
+    },
+    {
+        156, 156, 74, 74, 74, 74, 74, 74, 156, 156, 74, 74, 74, 74, 74, 74, 156, 156, 74, 74, 74, 74, 74, 74, 156, 156, 74, 74, 74, 156, 156, 156,
+        4, 4, 7, 45, 73, 4, 4, 156, 73, 7, 7, 7, 7, 73, 73, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 76, 76, 76, 73, 73, 156, 156,
+    },
+};
+
+} // namespace internal
+} // namespace kotlin
+
+#endif // RUNTIME_CHAR_PROPERTIES_TABLES_H
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "CharProperties.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace kotlin;
+
+namespace {
+
+KChar Lowercase(KChar ch) {
+    return static_cast<KChar>(ch + CharPropertiesOf(ch).lowercaseDelta);
+}
+
+KChar Uppercase(KChar ch) {
+    return static_cast<KChar>(ch + CharPropertiesOf(ch).uppercaseDelta);
+}
+
+KChar Titlecase(KChar ch) {
+    return static_cast<KChar>(ch + CharPropertiesOf(ch).titlecaseDelta);
+}
+
+} // namespace
+
+TEST(CharPropertiesTest, Category) {
+    EXPECT_EQ(char_category::kUppercaseLetter, CharPropertiesOf('A').category);
+    EXPECT_EQ(char_category::kLowercaseLetter, CharPropertiesOf('z').category);
+    EXPECT_EQ(char_category::kDecimalDigitNumber, CharPropertiesOf('7').category);
+    EXPECT_EQ(char_category::kDecimalDigitNumber, CharPropertiesOf(0x0663).category);
+    EXPECT_EQ(char_category::kTitlecaseLetter, CharPropertiesOf(0x01C5).category);
+    EXPECT_EQ(char_category::kOtherLetter, CharPropertiesOf(0x4E2D).category);
+    EXPECT_EQ(char_category::kFormat, CharPropertiesOf(0x00AD).category);
+    EXPECT_EQ(char_category::kUnassigned, CharPropertiesOf(0x0378).category);
+    EXPECT_EQ(char_category::kUnassigned, CharPropertiesOf(0xFFFF).category);
+    EXPECT_TRUE(IsLetterCategory(CharPropertiesOf(0x02B0).category));
+    EXPECT_FALSE(IsLetterCategory(CharPropertiesOf('_').category));
+}
+
+TEST(CharPropertiesTest, Whitespace) {
+    for (KChar ch : std::initializer_list<KChar>{'\t', '\n', '\r', ' ', 0x1C, 0xA0, 0x1680, 0x2000, 0x200A, 0x2028, 0x202F, 0x3000}) {
+        EXPECT_TRUE(CharPropertiesOf(ch).whitespace) << ch;
+    }
+    for (KChar ch : std::initializer_list<KChar>{'a', '0', 0x08, 0x200B, 0xFEFF}) {
+        EXPECT_FALSE(CharPropertiesOf(ch).whitespace) << ch;
+    }
+}
+
+TEST(CharPropertiesTest, Digit) {
+    EXPECT_EQ(0, CharPropertiesOf('0').digit);
+    EXPECT_EQ(9, CharPropertiesOf('9').digit);
+    EXPECT_EQ(10, CharPropertiesOf('a').digit);
+    EXPECT_EQ(35, CharPropertiesOf('Z').digit);
+    EXPECT_EQ(3, CharPropertiesOf(0x0663).digit);
+    EXPECT_EQ(1, CharPropertiesOf(0x0BE7).digit);
+    EXPECT_EQ(10, CharPropertiesOf(0xFF21).digit);
+    EXPECT_EQ(-1, CharPropertiesOf('/').digit);
+    EXPECT_EQ(-1, CharPropertiesOf('{').digit);
+    EXPECT_EQ(-1, CharPropertiesOf(0x00E9).digit);
+}
+
+TEST(CharPropertiesTest, CaseMapping) {
+    EXPECT_EQ('a', Lowercase('A'));
+    EXPECT_EQ('A', Uppercase('a'));
+    EXPECT_EQ('1', Uppercase('1'));
+    EXPECT_EQ(0x00E9, Lowercase(0x00C9));
+    EXPECT_EQ(0x0178, Uppercase(0x00FF));
+    EXPECT_EQ(0x023A, Uppercase(0x2C65));
+    EXPECT_EQ(0x01C4, Uppercase(0x01C6));
+    EXPECT_EQ(0x01C5, Titlecase(0x01C6));
+    EXPECT_EQ(0x01C5, Titlecase(0x01C4));
+    EXPECT_EQ(0x1C90, Uppercase(0x10D0));
+    EXPECT_EQ(0x10D0, Titlecase(0x10D0));
+    EXPECT_EQ(0xFF41, Lowercase(0xFF21));
+}
+
+TEST(CharPropertiesTest, CaseMappingPreservesLetters) {
+    for (uint32_t ch = 0; ch <= 0xFFFF; ++ch) {
+        uint8_t category = CharPropertiesOf(ch).category;
+        if (category == char_category::kUppercaseLetter || category == char_category::kLowercaseLetter) {
+            EXPECT_TRUE(IsLetterCategory(CharPropertiesOf(Lowercase(ch)).category)) << ch;
+            EXPECT_TRUE(IsLetterCategory(CharPropertiesOf(Uppercase(ch)).category)) << ch;
+        }
+    }
+}
@@ -5,7 +5,14 @@
 
 #include "Cleaner.h"
 
+#include <algorithm>
+#include <limits>
+#include <mutex>
+
+#include "Alloc.h"
 #include "Memory.h"
+#include "Mutex.hpp"
+#include "Porting.h"
 #include "Runtime.h"
 #include "Worker.h"
 
@@ -26,6 +33,71 @@ constexpr KInt kCleanerWorkerShutdown = -2;
 
 KInt globalCleanerWorker = kCleanerWorkerUninitialized;
 
+constexpr KInt kMaxCleanerWorkers = 16;
+
+// See `Platform.cleanerWorkersCount`.
+KInt g_cleanerWorkersCount = 1;
+
+// Disposed cleaners are not scheduled on the worker one by one, they are collected into a batch, which is executed
+// by a single job on the worker of the shard. At most one such job per shard is queued or running at a time, it runs
+// the cleaners added while it's running as well.
+struct CleanerShard {
+    kotlin::SpinLock lock;
+    KStdVector<KNativePtr> pending;
+    bool scheduled = false;
+    // When the oldest of `pending` cleaners was disposed.
+    uint64_t batchStartMicros = 0;
+    KInt worker = 0;
+};
+
+// Shards are never destroyed: workers may still be running when the program exits.
+CleanerShard* cleanerShards[kMaxCleanerWorkers] = {};
+
+// The number of workers and shards, fixed when the workers are created.
+KInt cleanerShardsCount = 0;
+
+KInt nextCleanerShard = 0;
+
+// Statistics, see `Cleaner.kt`.
+KInt pendingCleaners = 0;
+KInt peakPendingCleaners = 0;
+KInt executedCleaners = 0;
+KInt maxCleanerLagMicros = 0;
+
+void updateMaximum(KInt* maximum, KInt value) {
+    KInt current = atomicGet(maximum);
+    while (value > current && !compareAndSet(maximum, current, value)) {
+        current = atomicGet(maximum);
+    }
+}
+
+void runCleaners(void* argument) {
+    auto* shard = static_cast<CleanerShard*>(argument);
+    KStdVector<KNativePtr> batch;
+    while (true) {
+        uint64_t batchStartMicros = 0;
+        {
+            std::lock_guard<kotlin::SpinLock> guard(shard->lock);
+            if (shard->pending.empty()) {
+                shard->scheduled = false;
+                return;
+            }
+            // Keep the capacity of both vectors.
+            batch.swap(shard->pending);
+            batchStartMicros = shard->batchStartMicros;
+        }
+        uint64_t lag = std::min<uint64_t>(konan::getTimeMicros() - batchStartMicros, std::numeric_limits<KInt>::max());
+        updateMaximum(&maxCleanerLagMicros, static_cast<KInt>(lag));
+        for (KNativePtr cleaner : batch) {
+            WorkerRunScheduled(cleaner);
+        }
+        KInt size = static_cast<KInt>(batch.size());
+        atomicAdd(&pendingCleaners, -size);
+        atomicAdd(&executedCleaners, size);
+        batch.clear();
+    }
+}
+
 void disposeCleaner(CleanerImpl* thiz) {
     auto worker = atomicGet(&globalCleanerWorker);
     RuntimeAssert(
@@ -44,7 +116,24 @@ void disposeCleaner(CleanerImpl* thiz) {
 
     RuntimeAssert(worker > 0, "Cleaner worker must be fully initialized here");
 
-    bool result = WorkerSchedule(worker, thiz->cleanerStablePtr);
+    CleanerShard* shard = cleanerShards[0];
+    if (cleanerShardsCount > 1) {
+        shard = cleanerShards[static_cast<KUInt>(atomicAdd(&nextCleanerShard, 1)) % cleanerShardsCount];
+    }
+    updateMaximum(&peakPendingCleaners, atomicAdd(&pendingCleaners, 1));
+    bool schedule = false;
+    {
+        std::lock_guard<kotlin::SpinLock> guard(shard->lock);
+        if (shard->pending.empty()) {
+            shard->batchStartMicros = konan::getTimeMicros();
+        }
+        shard->pending.push_back(thiz->cleanerStablePtr);
+        schedule = !shard->scheduled;
+        shard->scheduled = true;
+    }
+    if (!schedule) return;
+
+    bool result = WorkerScheduleNative(shard->worker, runCleaners, shard);
     RuntimeAssert(result, "Couldn't find Cleaner worker");
 }
 
@@ -90,8 +179,18 @@ void ShutdownCleaners(bool executeScheduledCleaners) {
     RuntimeAssert(worker > 0, "Cleaner worker must be fully initialized here");
 
     atomicSet(&globalCleanerWorker, kCleanerWorkerShutdown);
-    Kotlin_CleanerImpl_shutdownCleanerWorker(worker, executeScheduledCleaners);
-    WaitNativeWorkerTermination(worker);
+    for (KInt i = 0; i < cleanerShardsCount; ++i) {
+        CleanerShard* shard = cleanerShards[i];
+        Kotlin_CleanerImpl_shutdownCleanerWorker(shard->worker, executeScheduledCleaners);
+        WaitNativeWorkerTermination(shard->worker);
+        // Only cleaners not to be executed are left here, the worker has discarded the job that would run them.
+        for (KNativePtr cleaner : shard->pending) {
+            DisposeStablePointer(cleaner);
+        }
+        atomicAdd(&pendingCleaners, -static_cast<KInt>(shard->pending.size()));
+        shard->pending.clear();
+        shard->scheduled = false;
+    }
 }
 
 extern "C" KInt Kotlin_CleanerImpl_getCleanerWorker() {
@@ -104,7 +203,14 @@ extern "C" KInt Kotlin_CleanerImpl_getCleanerWorker() {
                 // Someone else is trying to initialize the worker. Try again.
                 continue;
             }
-            worker = Kotlin_CleanerImpl_createCleanerWorker();
+            cleanerShardsCount = atomicGet(&g_cleanerWorkersCount);
+            for (KInt i = 0; i < cleanerShardsCount; ++i) {
+                if (cleanerShards[i] == nullptr) {
+                    cleanerShards[i] = konanConstructInstance<CleanerShard>();
+                }
+                cleanerShards[i]->worker = Kotlin_CleanerImpl_createCleanerWorker();
+            }
+            worker = cleanerShards[0]->worker;
             if (!compareAndSet(&globalCleanerWorker, kCleanerWorkerInitializing, worker)) {
                 RuntimeCheck(false, "Someone interrupted worker initializing");
             }
@@ -125,6 +231,47 @@ extern "C" KInt Kotlin_CleanerImpl_getCleanerWorker() {
     return worker;
 }
 
+extern "C" KInt Kotlin_CleanerImpl_getCleanerWorkersCount() {
+    Kotlin_CleanerImpl_getCleanerWorker();
+    return cleanerShardsCount;
+}
+
+extern "C" KInt Kotlin_CleanerImpl_getCleanerWorkerAt(KInt index) {
+    Kotlin_CleanerImpl_getCleanerWorker();
+    RuntimeAssert(index >= 0 && index < cleanerShardsCount, "Invalid cleaner worker index %d", index);
+    return cleanerShards[index]->worker;
+}
+
+extern "C" KInt Kotlin_CleanerImpl_getPendingCleanersCount() {
+    return atomicGet(&pendingCleaners);
+}
+
+extern "C" KInt Kotlin_CleanerImpl_getPeakPendingCleanersCount() {
+    return atomicGet(&peakPendingCleaners);
+}
+
+extern "C" KInt Kotlin_CleanerImpl_getExecutedCleanersCount() {
+    return atomicGet(&executedCleaners);
+}
+
+extern "C" KInt Kotlin_CleanerImpl_getMaxCleanerLagMicros() {
+    return atomicGet(&maxCleanerLagMicros);
+}
+
+extern "C" KInt Konan_Platform_getCleanerWorkersCount() {
+    return atomicGet(&g_cleanerWorkersCount);
+}
+
+extern "C" KBoolean Konan_Platform_setCleanerWorkersCount(KInt value) {
+    RuntimeAssert(value > 0 && value <= kMaxCleanerWorkers, "Invalid number of cleaner workers %d", value);
+    // The number of workers is read once, when they are created.
+    if (atomicGet(&globalCleanerWorker) != kCleanerWorkerUninitialized) return false;
+    atomicSet(&g_cleanerWorkersCount, value);
+    return true;
+}
+
 void ResetCleanerWorkerForTests() {
     atomicSet(&globalCleanerWorker, kCleanerWorkerUninitialized);
+    atomicSet(&g_cleanerWorkersCount, 1);
+    cleanerShardsCount = 0;
 }
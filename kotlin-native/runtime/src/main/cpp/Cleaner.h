@@ -13,7 +13,13 @@ RUNTIME_NOTHROW void DisposeCleaner(KRef thiz);
 
 void ShutdownCleaners(bool executeScheduledCleaners);
 
+// Returns the first of cleaner workers, creating all of them if needed.
 extern "C" KInt Kotlin_CleanerImpl_getCleanerWorker();
+extern "C" KInt Kotlin_CleanerImpl_getCleanerWorkersCount();
+extern "C" KInt Kotlin_CleanerImpl_getCleanerWorkerAt(KInt index);
+
+// Returns false and changes nothing if the cleaner workers have been created already.
+extern "C" KBoolean Konan_Platform_setCleanerWorkersCount(KInt value);
 
 void ResetCleanerWorkerForTests();
 
@@ -79,3 +79,31 @@ TEST(CleanerTest, ShutdownWithCreation) {
     EXPECT_CALL(*shutdownCleanerWorkerMock, Call(workerId, executeScheduledCleaners));
     ShutdownCleaners(executeScheduledCleaners);
 }
+
+TEST(CleanerTest, ShutdownWithSeveralWorkers) {
+    ResetCleanerWorkerForTests();
+    EXPECT_TRUE(Konan_Platform_setCleanerWorkersCount(3));
+
+    constexpr bool executeScheduledCleaners = false;
+
+    auto createCleanerWorkerMock = ScopedCreateCleanerWorkerMock();
+    auto shutdownCleanerWorkerMock = ScopedShutdownCleanerWorkerMock();
+
+    EXPECT_CALL(*createCleanerWorkerMock, Call())
+            .WillOnce(testing::Return(42))
+            .WillOnce(testing::Return(43))
+            .WillOnce(testing::Return(44));
+    EXPECT_THAT(Kotlin_CleanerImpl_getCleanerWorker(), 42);
+    EXPECT_THAT(Kotlin_CleanerImpl_getCleanerWorkersCount(), 3);
+    EXPECT_THAT(Kotlin_CleanerImpl_getCleanerWorkerAt(2), 44);
+
+    // Can't be changed once the workers are created.
+    EXPECT_FALSE(Konan_Platform_setCleanerWorkersCount(1));
+    EXPECT_THAT(Kotlin_CleanerImpl_getCleanerWorkersCount(), 3);
+
+    testing::InSequence sequence;
+    EXPECT_CALL(*shutdownCleanerWorkerMock, Call(42, executeScheduledCleaners));
+    EXPECT_CALL(*shutdownCleanerWorkerMock, Call(43, executeScheduledCleaners));
+    EXPECT_CALL(*shutdownCleanerWorkerMock, Call(44, executeScheduledCleaners));
+    ShutdownCleaners(executeScheduledCleaners);
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_CODE_POINT_TABLE_H
+#define RUNTIME_CODE_POINT_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#include "Types.h"
+
+namespace kotlin {
+
+namespace internal {
+
+// Number of `blockSize` aligned blocks of code points containing at least one of sorted `keys`.
+template <size_t N>
+constexpr size_t UsedBlockCount(const KInt (&keys)[N], size_t blockSize) noexcept {
+    size_t count = 0;
+    for (size_t i = 0; i < N; ++i) {
+        if (i == 0 || keys[i] / blockSize != keys[i - 1] / blockSize) ++count;
+    }
+    return count;
+}
+
+} // namespace internal
+
+// Maps code points to values, built at compile time from a sorted array of code points `Keys` and a function
+// giving the value for a key index. The code point space is split into blocks of `BlockSize`, blocks without keys
+// share the single default-filled one, so lookup is two loads with no search. Code points beyond the last key,
+// and negative ones, map to `Value()`.
+template <typename Value, const auto& Keys, size_t BlockSize = 64>
+class CodePointTable {
+public:
+    template <typename ValueAt>
+    constexpr explicit CodePointTable(ValueAt valueAt) noexcept : blockIndices_(), blocks_() {
+        uint16_t usedBlocks = 0;
+        for (size_t i = 0; i < kKeyCount; ++i) {
+            size_t block = Keys[i] / BlockSize;
+            if (blockIndices_[block] == 0) blockIndices_[block] = ++usedBlocks;
+            blocks_[blockIndices_[block]][Keys[i] % BlockSize] = valueAt(i);
+        }
+    }
+
+    constexpr Value operator[](KInt codePoint) const noexcept {
+        auto index = static_cast<uint32_t>(codePoint);
+        if (index >= kBlockCount * BlockSize) return Value();
+        return blocks_[blockIndices_[index / BlockSize]][index % BlockSize];
+    }
+
+private:
+    static constexpr size_t kKeyCount = std::size(Keys);
+    static constexpr size_t kBlockCount = Keys[kKeyCount - 1] / BlockSize + 1;
+    static constexpr size_t kUsedBlockCount = internal::UsedBlockCount(Keys, BlockSize);
+    static_assert(kUsedBlockCount < UINT16_MAX, "Too many blocks for 16-bit indices");
+
+    uint16_t blockIndices_[kBlockCount];
+    // Block 0 holds only default values.
+    Value blocks_[kUsedBlockCount + 1][BlockSize];
+};
+
+// Set of code points from a sorted array `Keys`, a CodePointTable of bits with 64-bit blocks.
+template <const auto& Keys>
+class CodePointSet {
+public:
+    constexpr CodePointSet() noexcept : blockIndices_(), blocks_() {
+        uint16_t usedBlocks = 0;
+        for (size_t i = 0; i < kKeyCount; ++i) {
+            size_t block = Keys[i] / kBlockSize;
+            if (blockIndices_[block] == 0) blockIndices_[block] = ++usedBlocks;
+            blocks_[blockIndices_[block]] |= uint64_t(1) << (Keys[i] % kBlockSize);
+        }
+    }
+
+    constexpr bool contains(KInt codePoint) const noexcept {
+        auto index = static_cast<uint32_t>(codePoint);
+        if (index >= kBlockCount * kBlockSize) return false;
+        return (blocks_[blockIndices_[index / kBlockSize]] >> (index % kBlockSize)) & 1;
+    }
+
+private:
+    static constexpr size_t kBlockSize = 64;
+    static constexpr size_t kKeyCount = std::size(Keys);
+    static constexpr size_t kBlockCount = Keys[kKeyCount - 1] / kBlockSize + 1;
+    static constexpr size_t kUsedBlockCount = internal::UsedBlockCount(Keys, kBlockSize);
+    static_assert(kUsedBlockCount < UINT16_MAX, "Too many blocks for 16-bit indices");
+
+    uint16_t blockIndices_[kBlockCount];
+    uint64_t blocks_[kUsedBlockCount + 1];
+};
+
+} // namespace kotlin
+
+#endif // RUNTIME_CODE_POINT_TABLE_H
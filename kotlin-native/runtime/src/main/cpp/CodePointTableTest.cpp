@@ -0,0 +1,64 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "CodePointTable.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace kotlin;
+
+namespace {
+
+constexpr KInt kKeys[] = {0, 5, 63, 64, 300, 1000, 1001, 70000};
+constexpr KInt kValues[] = {10, 11, 12, 13, 14, 15, 16, 17};
+
+constexpr CodePointTable<uint8_t, kKeys> kTable([](size_t index) { return static_cast<uint8_t>(kValues[index]); });
+constexpr CodePointTable<uint8_t, kKeys, 16> kSmallBlocksTable([](size_t index) { return static_cast<uint8_t>(kValues[index]); });
+constexpr CodePointSet<kKeys> kSet;
+
+static_assert(kTable[300] == 14, "Lookups must work at compile time");
+static_assert(kSet.contains(1001), "Lookups must work at compile time");
+
+template <typename Lookup>
+void CheckAllCodePoints(Lookup lookup, KInt none) {
+    size_t key = 0;
+    for (KInt codePoint = -2; codePoint <= 0x10FFFF; ++codePoint) {
+        if (key < std::size(kKeys) && kKeys[key] == codePoint) {
+            ASSERT_EQ(kValues[key], lookup(codePoint)) << codePoint;
+            ++key;
+        } else {
+            ASSERT_EQ(none, lookup(codePoint)) << codePoint;
+        }
+    }
+}
+
+} // namespace
+
+TEST(CodePointTableTest, Lookup) {
+    CheckAllCodePoints([](KInt codePoint) { return kTable[codePoint]; }, 0);
+    CheckAllCodePoints([](KInt codePoint) { return kSmallBlocksTable[codePoint]; }, 0);
+}
+
+TEST(CodePointTableTest, OutOfRange) {
+    EXPECT_EQ(0, kTable[-1]);
+    EXPECT_EQ(0, kTable[0x7FFFFFFF]);
+    EXPECT_EQ(0, kTable[static_cast<KInt>(0x80000000)]);
+    EXPECT_FALSE(kSet.contains(-1));
+    EXPECT_FALSE(kSet.contains(0x7FFFFFFF));
+}
+
+TEST(CodePointSetTest, Contains) {
+    // Maps keys to their values and everything else to zero, so it can be checked like a table.
+    CheckAllCodePoints(
+            [](KInt codePoint) {
+                if (!kSet.contains(codePoint)) return KInt(0);
+                for (size_t i = 0; i < std::size(kKeys); ++i) {
+                    if (kKeys[i] == codePoint) return kValues[i];
+                }
+                return KInt(-1);
+            },
+            0);
+}
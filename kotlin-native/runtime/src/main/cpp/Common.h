@@ -26,6 +26,8 @@
 
 #define ALWAYS_INLINE __attribute__((always_inline))
 #define NO_INLINE __attribute__((noinline))
+// For code that reads memory it doesn't own, e.g. whole thread stacks.
+#define NO_SANITIZE_ADDRESS __attribute__((no_sanitize("address")))
 
 #if KONAN_NO_THREADS
 #define THREAD_LOCAL_VARIABLE
@@ -33,6 +35,15 @@
 #define THREAD_LOCAL_VARIABLE __thread
 #endif
 
+// For thread locals read on hot paths: the initial-exec model accesses them at a fixed offset from the thread pointer
+// instead of calling __tls_get_addr. Android before API 29 doesn't support it in dlopen'ed libraries, and Windows
+// emulates thread locals anyway.
+#if KONAN_NO_THREADS || KONAN_ANDROID || KONAN_WINDOWS
+#define TLS_INITIAL_EXEC
+#else
+#define TLS_INITIAL_EXEC __attribute__((tls_model("initial-exec")))
+#endif
+
 #define ARRAY_SIZE(a) (sizeof(a) / sizeof(a[0]))
 
 #if KONAN_OBJC_INTEROP
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_CONCURRENT_WEAK_HASH_SET_H
+#define RUNTIME_CONCURRENT_WEAK_HASH_SET_H
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+
+#include "Alloc.h"
+#include "Mutex.hpp"
+#include "Utils.hpp"
+
+namespace kotlin {
+
+// A hash set of pointers that doesn't keep its elements alive. Split into independently locked shards
+// to keep contention low.
+//
+// `Traits` must provide:
+//   static size_t Hash(const T* value) noexcept;
+//   static bool Equals(const T* lhs, const T* rhs) noexcept;
+//   // Must fail, if `value` is already dying.
+//   static bool TryRetain(T* value) noexcept;
+//
+// The owner of an element must call `Erase` before the element's memory is released.
+template <typename T, typename Traits, typename Mutex = SpinLock, size_t kShardCount = 64>
+class ConcurrentWeakHashSet : private Pinned {
+public:
+    // If the set contains a live element equal to `value`, retains it with `Traits::TryRetain` and returns it
+    // with `false`. Otherwise, inserts `value` itself (replacing a dying equal element, if any) and returns it with `true`.
+    std::pair<T*, bool> FindOrInsert(T* value) noexcept {
+        size_t hash = Traits::Hash(value);
+        auto& shard = ShardFor(hash);
+        std::lock_guard<Mutex> guard(shard.mutex);
+        auto it = shard.set.find(value);
+        if (it != shard.set.end()) {
+            T* existing = *it;
+            if (existing == value || Traits::TryRetain(existing)) {
+                return {existing, existing == value};
+            }
+            // `existing` is being destroyed, its `Erase` will find `value` instead and do nothing.
+            shard.set.erase(it);
+        }
+        shard.set.insert(value);
+        return {value, true};
+    }
+
+    // Removes exactly `value` from the set. Does nothing if the set holds another element equal to `value`.
+    void Erase(T* value) noexcept {
+        size_t hash = Traits::Hash(value);
+        auto& shard = ShardFor(hash);
+        std::lock_guard<Mutex> guard(shard.mutex);
+        auto it = shard.set.find(value);
+        if (it != shard.set.end() && *it == value) {
+            shard.set.erase(it);
+        }
+    }
+
+    // Locks each shard in turn, so the result is only exact when there are no concurrent modifications.
+    size_t Size() noexcept {
+        size_t result = 0;
+        for (auto& shard : shards_) {
+            std::lock_guard<Mutex> guard(shard.mutex);
+            result += shard.set.size();
+        }
+        return result;
+    }
+
+private:
+    struct Hasher {
+        size_t operator()(const T* value) const noexcept { return Traits::Hash(value); }
+    };
+
+    struct Equality {
+        bool operator()(const T* lhs, const T* rhs) const noexcept { return lhs == rhs || Traits::Equals(lhs, rhs); }
+    };
+
+    struct Shard {
+        Mutex mutex;
+        std::unordered_set<T*, Hasher, Equality, KonanAllocator<T*>> set;
+    };
+
+    Shard& ShardFor(size_t hash) noexcept {
+        // Mix the high bits in: the inner set already uses the low ones for bucketing.
+        return shards_[(hash ^ (hash >> 16)) % kShardCount];
+    }
+
+    Shard shards_[kShardCount];
+};
+
+} // namespace kotlin
+
+#endif // RUNTIME_CONCURRENT_WEAK_HASH_SET_H
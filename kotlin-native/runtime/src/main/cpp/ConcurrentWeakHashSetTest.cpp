@@ -0,0 +1,135 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ConcurrentWeakHashSet.hpp"
+
+#include <atomic>
+#include <thread>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "TestSupport.hpp"
+#include "Types.h"
+
+using namespace kotlin;
+
+namespace {
+
+struct Item {
+    Item(int key, int refCount) : key(key), refCount(refCount) {}
+
+    int key;
+    std::atomic<int> refCount;
+};
+
+struct ItemTraits {
+    static size_t Hash(const Item* item) noexcept { return item->key; }
+    static bool Equals(const Item* lhs, const Item* rhs) noexcept { return lhs->key == rhs->key; }
+    static bool TryRetain(Item* item) noexcept {
+        int refCount = item->refCount.load();
+        do {
+            if (refCount == 0) return false;
+        } while (!item->refCount.compare_exchange_weak(refCount, refCount + 1));
+        return true;
+    }
+};
+
+using ItemSet = ConcurrentWeakHashSet<Item, ItemTraits>;
+
+} // namespace
+
+TEST(ConcurrentWeakHashSetTest, InsertDistinct) {
+    ItemSet set;
+    Item first(1, 1);
+    Item second(2, 1);
+
+    EXPECT_THAT(set.FindOrInsert(&first), std::make_pair(&first, true));
+    EXPECT_THAT(set.FindOrInsert(&second), std::make_pair(&second, true));
+    EXPECT_THAT(set.Size(), 2);
+}
+
+TEST(ConcurrentWeakHashSetTest, FindEqualRetains) {
+    ItemSet set;
+    Item first(1, 1);
+    Item duplicate(1, 1);
+
+    set.FindOrInsert(&first);
+    EXPECT_THAT(set.FindOrInsert(&duplicate), std::make_pair(&first, false));
+    EXPECT_THAT(first.refCount.load(), 2);
+    EXPECT_THAT(duplicate.refCount.load(), 1);
+    EXPECT_THAT(set.Size(), 1);
+}
+
+TEST(ConcurrentWeakHashSetTest, FindSameDoesNotRetain) {
+    ItemSet set;
+    Item first(1, 1);
+
+    set.FindOrInsert(&first);
+    EXPECT_THAT(set.FindOrInsert(&first), std::make_pair(&first, true));
+    EXPECT_THAT(first.refCount.load(), 1);
+}
+
+TEST(ConcurrentWeakHashSetTest, ReplaceDying) {
+    ItemSet set;
+    Item dying(1, 1);
+    Item replacement(1, 1);
+
+    set.FindOrInsert(&dying);
+    dying.refCount = 0;
+    EXPECT_THAT(set.FindOrInsert(&replacement), std::make_pair(&replacement, true));
+
+    // Late removal of the dying element must keep the replacement.
+    set.Erase(&dying);
+    EXPECT_THAT(set.Size(), 1);
+    Item duplicate(1, 1);
+    EXPECT_THAT(set.FindOrInsert(&duplicate), std::make_pair(&replacement, false));
+}
+
+TEST(ConcurrentWeakHashSetTest, Erase) {
+    ItemSet set;
+    Item first(1, 1);
+    Item second(2, 1);
+
+    set.FindOrInsert(&first);
+    set.FindOrInsert(&second);
+    set.Erase(&first);
+    EXPECT_THAT(set.Size(), 1);
+
+    Item duplicate(1, 1);
+    EXPECT_THAT(set.FindOrInsert(&duplicate), std::make_pair(&duplicate, true));
+}
+
+TEST(ConcurrentWeakHashSetTest, ConcurrentFindOrInsert) {
+    ItemSet set;
+    constexpr int kThreadCount = kDefaultThreadCount;
+    constexpr int kKeyCount = 100;
+
+    KStdVector<KStdVector<KStdUniquePtr<Item>>> items(kThreadCount);
+    KStdVector<KStdVector<Item*>> results(kThreadCount);
+    std::atomic<bool> canStart(false);
+    KStdVector<std::thread> threads;
+    for (int i = 0; i < kThreadCount; ++i) {
+        for (int key = 0; key < kKeyCount; ++key) {
+            items[i].push_back(make_unique<Item>(key, 1));
+        }
+        threads.emplace_back([i, &items, &results, &set, &canStart]() {
+            while (!canStart) {
+            }
+            for (auto& item : items[i]) {
+                results[i].push_back(set.FindOrInsert(item.get()).first);
+            }
+        });
+    }
+    canStart = true;
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_THAT(set.Size(), kKeyCount);
+    for (int i = 1; i < kThreadCount; ++i) {
+        EXPECT_THAT(results[i], testing::ElementsAreArray(results[0]));
+    }
+}
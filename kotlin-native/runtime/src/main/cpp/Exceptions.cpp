@@ -18,7 +18,11 @@
 #include <string.h>
 #include <stdint.h>
 
+#include <algorithm>
+#include <atomic>
 #include <exception>
+#include <limits>
+#include <mutex>
 #include <unistd.h>
 
 #if KONAN_NO_EXCEPTIONS
@@ -48,36 +52,41 @@
 
 namespace {
 
-#if USE_GCC_UNWIND
-struct Backtrace {
-  Backtrace(int count, int skip) : index(0), skipCount(skip) {
-    uint32_t size = count - skipCount;
-    if (size < 0) {
-      size = 0;
-    }
-    auto result = AllocArrayInstance(theNativePtrArrayTypeInfo, size, arrayHolder.slot());
-    // TODO: throw cached OOME?
-    RuntimeCheck(result != nullptr, "Cannot create backtrace array");
-  }
+// See `Platform.maxStackTraceDepth`.
+int32_t g_maxStackTraceDepth = std::numeric_limits<int32_t>::max();
 
-  void setNextElement(_Unwind_Ptr element) {
-    Kotlin_NativePtrArray_set(obj(), index++, (KNativePtr) element);
+// Types passed to `Platform.disableStackTraceCapture`. Entries are only appended, so readers need no lock.
+constexpr int kMaxExcludedTypes = 16;
+std::atomic<const TypeInfo*> excludedTypes[kMaxExcludedTypes];
+std::atomic<int> excludedTypesCount{0};
+kotlin::SpinLock excludedTypesLock;
+
+bool isStackTraceCaptured(KConstRef throwable) {
+  if (g_maxStackTraceDepth == 0) return false;
+  int count = excludedTypesCount.load(std::memory_order_acquire);
+  for (int index = 0; index < count; ++index) {
+    if (IsInstance(throwable, excludedTypes[index].load(std::memory_order_relaxed))) return false;
   }
+  return true;
+}
 
-  ObjHeader* obj() { return arrayHolder.obj(); }
+#ifndef OMIT_BACKTRACE
+// Frames are captured into this buffer first and then copied into an array of the exact size, so that most
+// stack traces take a single pass of the unwinder and no allocation besides the array itself.
+constexpr int kStackTraceBufferSize = 128;
+THREAD_LOCAL_VARIABLE KNativePtr stackTraceBuffer[kStackTraceBufferSize];
+#endif
 
-  int index;
+#if USE_GCC_UNWIND
+struct Backtrace {
+  KNativePtr* buffer;
+  int capacity;
   int skipCount;
-  ObjHolder arrayHolder;
+  int maxDepth;
+  // Counts frames beyond the capacity too, up to maxDepth.
+  int depth;
 };
 
-_Unwind_Reason_Code depthCountCallback(
-    struct _Unwind_Context * context, void* arg) {
-  int* result = reinterpret_cast<int*>(arg);
-  (*result)++;
-  return _URC_NO_REASON;
-}
-
 _Unwind_Reason_Code unwindCallback(
     struct _Unwind_Context* context, void* arg) {
   Backtrace* backtrace = reinterpret_cast<Backtrace*>(arg);
@@ -85,13 +94,19 @@ _Unwind_Reason_Code unwindCallback(
     backtrace->skipCount--;
     return _URC_NO_REASON;
   }
+  if (backtrace->depth == backtrace->maxDepth) {
+    return _URC_NORMAL_STOP;
+  }
 
 #if (__MINGW32__ || __MINGW64__)
   _Unwind_Ptr address = _Unwind_GetRegionStart(context);
 #else
   _Unwind_Ptr address = _Unwind_GetIP(context);
 #endif
-  backtrace->setNextElement(address);
+  if (backtrace->depth < backtrace->capacity) {
+    backtrace->buffer[backtrace->depth] = (KNativePtr) address;
+  }
+  backtrace->depth++;
 
   return _URC_NO_REASON;
 }
@@ -111,38 +126,69 @@ SourceInfo getSourceInfo(KConstRef stackTrace, int index) {
 
 // TODO: this implementation is just a hack, e.g. the result is inexact;
 // however it is better to have an inexact stacktrace than not to have any.
-NO_INLINE OBJ_GETTER0(Kotlin_getCurrentStackTrace) {
+NO_INLINE OBJ_GETTER(Kotlin_getCurrentStackTrace, KConstRef throwable) {
 #if OMIT_BACKTRACE
   return AllocArrayInstance(theNativePtrArrayTypeInfo, 0, OBJ_RESULT);
 #else
+  if (!isStackTraceCaptured(throwable))
+    return AllocArrayInstance(theNativePtrArrayTypeInfo, 0, OBJ_RESULT);
+
   // Skips first 2 elements as irrelevant: this function and primary Throwable constructor.
   constexpr int kSkipFrames = 2;
 #if USE_GCC_UNWIND
-  int depth = 0;
-  _Unwind_Backtrace(depthCountCallback, &depth);
-  Backtrace result(depth, kSkipFrames);
-  if (result.obj()->array()->count_ > 0) {
-    _Unwind_Backtrace(unwindCallback, &result);
+  Backtrace backtrace = { stackTraceBuffer, kStackTraceBufferSize, kSkipFrames, g_maxStackTraceDepth, 0 };
+  _Unwind_Backtrace(unwindCallback, &backtrace);
+  ObjHolder resultHolder;
+  ObjHeader* result = AllocArrayInstance(theNativePtrArrayTypeInfo, backtrace.depth, resultHolder.slot());
+  KNativePtr* frames = PrimitiveArrayAddressOfElementAt<KNativePtr>(result->array(), 0);
+  if (backtrace.depth <= kStackTraceBufferSize) {
+    memcpy(frames, stackTraceBuffer, backtrace.depth * sizeof(KNativePtr));
+  } else {
+    // Too deep for the buffer: unwind again straight into the array, which now has the right size.
+    backtrace = { frames, backtrace.depth, kSkipFrames, backtrace.depth, 0 };
+    _Unwind_Backtrace(unwindCallback, &backtrace);
   }
-  RETURN_OBJ(result.obj());
+  RETURN_OBJ(result);
 #else
   const int maxSize = 32;
-  void* buffer[maxSize];
-
-  int size = backtrace(buffer, maxSize);
+  // Clamp before adding: the default depth is INT32_MAX.
+  int size = backtrace(stackTraceBuffer, std::min(maxSize - kSkipFrames, g_maxStackTraceDepth) + kSkipFrames);
   if (size < kSkipFrames)
     return AllocArrayInstance(theNativePtrArrayTypeInfo, 0, OBJ_RESULT);
 
   ObjHolder resultHolder;
   ObjHeader* result = AllocArrayInstance(theNativePtrArrayTypeInfo, size - kSkipFrames, resultHolder.slot());
-  for (int index = kSkipFrames; index < size; ++index) {
-    Kotlin_NativePtrArray_set(result, index - kSkipFrames, buffer[index]);
-  }
+  memcpy(PrimitiveArrayAddressOfElementAt<KNativePtr>(result->array(), 0), stackTraceBuffer + kSkipFrames,
+         (size - kSkipFrames) * sizeof(KNativePtr));
   RETURN_OBJ(result);
 #endif
 #endif  // !OMIT_BACKTRACE
 }
 
+extern "C" {
+
+KInt Konan_Platform_getMaxStackTraceDepth() {
+  return g_maxStackTraceDepth;
+}
+
+void Konan_Platform_setMaxStackTraceDepth(KInt value) {
+  g_maxStackTraceDepth = value;
+}
+
+KBoolean Konan_Platform_disableStackTraceCapture(const TypeInfo* typeInfo) {
+  std::lock_guard<kotlin::SpinLock> guard(excludedTypesLock);
+  int count = excludedTypesCount.load(std::memory_order_relaxed);
+  for (int index = 0; index < count; ++index) {
+    if (excludedTypes[index].load(std::memory_order_relaxed) == typeInfo) return true;
+  }
+  if (count == kMaxExcludedTypes) return false;
+  excludedTypes[count].store(typeInfo, std::memory_order_relaxed);
+  excludedTypesCount.store(count + 1, std::memory_order_release);
+  return true;
+}
+
+}  // extern "C"
+
 OBJ_GETTER(GetStackTraceStrings, KConstRef stackTrace) {
 #if OMIT_BACKTRACE
   ObjHeader* result = AllocArrayInstance(theArrayTypeInfo, 1, OBJ_RESULT);
@@ -23,8 +23,8 @@
 extern "C" {
 #endif
 
-// Returns current stacktrace as Array<String>.
-OBJ_GETTER0(Kotlin_getCurrentStackTrace);
+// Returns current stacktrace as NativePtrArray, empty if capturing stack traces of `throwable` is disabled.
+OBJ_GETTER(Kotlin_getCurrentStackTrace, KConstRef throwable);
 
 OBJ_GETTER(GetStackTraceStrings, KConstRef stackTrace);
 
@@ -28,9 +28,12 @@
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
 
-#include <vector>
+#include <algorithm>
+#include <mutex>
 
+#include "Common.h"
 #include "KAssert.h"
 
 namespace {
@@ -51,15 +54,31 @@ namespace {
 #error "Impossible ELFSIZE"
 #endif
 
-struct SymRecord {
-  Elf_Sym* symtabBegin;
-  Elf_Sym* symtabEnd;
-  char* strtab;
+// Address range of a symbol from the symbol tables of the executable.
+struct SymbolRange {
+  unsigned long begin;
+  unsigned long end;
+  // The largest `end` among this and all preceding ranges: looking for an enclosing range can stop
+  // as soon as it is not above the address.
+  unsigned long maxEnd;
+  const char* name;
 };
 
-typedef KStdVector<SymRecord> SymRecordList;
+typedef KStdVector<SymbolRange> SymbolTable;
 
-SymRecordList* symbols = nullptr;
+// Built once on the first lookup, sorted by `begin`. Other threads looking up symbols meanwhile block rather than
+// spin, as building the table maps the executable and sorts all of its symbols.
+SymbolTable* symbols = nullptr;
+std::once_flag symbolsOnce;
+
+// Recently resolved addresses of the current thread: stack traces of a thread mostly repeat the same frames.
+struct CachedSymbol {
+  const void* address;
+  const char* name;
+};
+
+constexpr size_t kSymbolCacheSize = 64;
+THREAD_LOCAL_VARIABLE CachedSymbol symbolCache[kSymbolCacheSize];
 
 // Unfortunately, symbol tables are stored in ELF sections not mapped
 // during regular execution, so we have to map binary ourselves.
@@ -67,41 +86,84 @@ Elf_Ehdr* findElfHeader() {
   int fd = open("/proc/self/exe", O_RDONLY);
   if (fd < 0) return nullptr;
   struct stat fd_stat;
-  if (fstat(fd, &fd_stat) < 0) return nullptr;
-  void* result = mmap(nullptr, fd_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  void* result = MAP_FAILED;
+  if (fstat(fd, &fd_stat) == 0) {
+    result = mmap(nullptr, fd_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  // The mapping stays valid after the descriptor is closed.
+  close(fd);
   if (result == MAP_FAILED) return nullptr;
   return (Elf_Ehdr*)result;
 }
 
-void initSymbols() {
-  RuntimeAssert(symbols == nullptr, "Init twice");
-  symbols = konanConstructInstance<SymRecordList>();
+void addSymbols(SymbolTable* table, char* mapAddress, Elf_Shdr* shdr, Elf_Shdr* strtabShdr) {
+  Elf_Sym* begin = (Elf_Sym*)(mapAddress + shdr->sh_offset);
+  Elf_Sym* end = (Elf_Sym*)((char*)begin + shdr->sh_size);
+  char* strtab = mapAddress + strtabShdr->sh_offset;
+  for (Elf_Sym* symbol = begin; symbol < end; ++symbol) {
+    // Empty and undefined symbols can't contain an address.
+    if (symbol->st_size == 0 || symbol->st_shndx == SHN_UNDEF) continue;
+    // st_value is load address adjusted.
+    unsigned long value = symbol->st_value;
+    table->push_back({value, value + symbol->st_size, 0, &strtab[symbol->st_name]});
+  }
+}
+
+SymbolTable* initSymbols() {
+  SymbolTable* table = konanConstructInstance<SymbolTable>();
   Elf_Ehdr* ehdr = findElfHeader();
-  if (ehdr == nullptr) return;
+  if (ehdr == nullptr) return table;
   RuntimeAssert(strncmp((const char*)ehdr->e_ident, ELFMAG, SELFMAG) == 0, "Must be an ELF");
   char* mapAddress = (char*)ehdr;
   Elf_Shdr* shdr = (Elf_Shdr*)(mapAddress + ehdr->e_shoff);
   for (int i = 0; i < ehdr->e_shnum; i++) {
-    if (shdr[i].sh_type == SHT_SYMTAB) {   // Static symbol table.
-      SymRecord record;
-      record.symtabBegin = (Elf_Sym*)(mapAddress + shdr[i].sh_offset);
-      record.symtabEnd = (Elf_Sym*)((char*)record.symtabBegin + shdr[i].sh_size);
-      record.strtab = (char *)(mapAddress + shdr[shdr[i].sh_link].sh_offset);
-      symbols->push_back(record);
+    // Static and dynamic symbol tables.
+    if (shdr[i].sh_type == SHT_SYMTAB || shdr[i].sh_type == SHT_DYNSYM) {
+      addSymbols(table, mapAddress, &shdr[i], &shdr[shdr[i].sh_link]);
     }
-    if (shdr[i].sh_type == SHT_DYNSYM) {   // Dynamic symbol table.
-      SymRecord record;
-      record.symtabBegin = (Elf_Sym*)(mapAddress + shdr[i].sh_offset);
-      record.symtabEnd = (Elf_Sym*)((char*)record.symtabBegin + shdr[i].sh_size);
-      record.strtab = (char*)(mapAddress + shdr[shdr[i].sh_link].sh_offset);
-      symbols->push_back(record);
+  }
+  // Stable to keep aliases in the order of the symbol tables.
+  std::stable_sort(table->begin(), table->end(), [](const SymbolRange& left, const SymbolRange& right) {
+    return left.begin < right.begin;
+  });
+  unsigned long maxEnd = 0;
+  for (auto& range : *table) {
+    maxEnd = std::max(maxEnd, range.end);
+    range.maxEnd = maxEnd;
+  }
+  return table;
+}
+
+SymbolTable* getSymbols() {
+  std::call_once(symbolsOnce, [] { symbols = initSymbols(); });
+  return symbols;
+}
+
+const char* findSymbol(unsigned long address) {
+  SymbolTable* table = getSymbols();
+  // The first range starting after the address, everything before it starts at or below the address.
+  auto it = std::upper_bound(table->begin(), table->end(), address, [](unsigned long value, const SymbolRange& range) {
+    return value < range.begin;
+  });
+  // Of the ranges containing the address, the innermost one is found first.
+  while (it != table->begin()) {
+    --it;
+    if (it->maxEnd <= address) break;
+    if (address < it->end) {
+      // Of aliases, return the one that comes first in the symbol tables, as the linear search used to.
+      while (it != table->begin() && (it - 1)->begin == it->begin && address < (it - 1)->end) --it;
+      return it->name;
     }
   }
+  return nullptr;
 }
 
 const char* addressToSymbol(const void* address) {
   if (address == nullptr) return nullptr;
 
+  CachedSymbol& cached = symbolCache[((unsigned long)address >> 2) % kSymbolCacheSize];
+  if (cached.address == address) return cached.name;
+
   // First, look up in dynamically loaded symbols.
   Dl_info info;
   if (dladdr(address, &info) != 0 && info.dli_sname != nullptr) {
@@ -109,24 +171,13 @@ const char* addressToSymbol(const void* address) {
   }
 
   // Otherwise, consult symbol table of the file.
-  if (symbols == nullptr) {
-    initSymbols();
-  }
-
-  unsigned long addressValue = (unsigned long)address;
-
-  for (auto record : *symbols) {
-    auto begin = record.symtabBegin;
-    auto end = record.symtabEnd;
-    while (begin < end) {
-      // st_value is load address adjusted.
-      if (addressValue >= begin->st_value && addressValue < begin->st_value + begin->st_size) {
-        return &record.strtab[begin->st_name];
-      }
-      begin++;
-    }
+  const char* result = findSymbol((unsigned long)address);
+  // Only the names from the executable are cached: they stay valid, unlike those of libraries that may be unloaded.
+  if (result != nullptr) {
+    cached.address = address;
+    cached.name = result;
   }
-  return nullptr;
+  return result;
 }
 
 }  // namespace
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_FIXED_SIZE_POOL_H
+#define RUNTIME_FIXED_SIZE_POOL_H
+
+#include <cstddef>
+#include <mutex>
+
+#include "Alloc.h"
+#include "KAssert.h"
+#include "Mutex.hpp"
+#include "Utils.hpp"
+
+namespace kotlin {
+
+// Memory for small objects of the same size which are allocated and freed often, e.g. meta objects. Cells are carved
+// out of page-sized slabs, so they don't pay for a malloc header each and lie next to each other. Freed cells are
+// reused by later allocations, slabs are never returned to the system. Thread-safe.
+template <size_t kCellSize, size_t kCellAlignment = alignof(void*)>
+class FixedSizePool : private Pinned {
+public:
+    constexpr FixedSizePool() noexcept = default;
+
+    // All cells must have been freed by now. Global pools are `[[clang::no_destroy]]`: objects may still use their
+    // cells during process exit.
+    ~FixedSizePool() {
+        Slab* slab = slabs_;
+        while (slab != nullptr) {
+            Slab* next = slab->next;
+            konanFreeMemory(slab);
+            slab = next;
+        }
+    }
+
+    // Returns uninitialized memory of `kCellSize` bytes.
+    void* Allocate() noexcept {
+        std::lock_guard<SpinLock> guard(lock_);
+        if (freeList_ != nullptr) {
+            Cell* cell = freeList_;
+            freeList_ = cell->next;
+            return cell;
+        }
+        if (nextCell_ == slabEnd_) {
+            auto* slab = static_cast<Slab*>(konanAllocMemory(sizeof(Slab)));
+            RuntimeCheck(slab != nullptr, "Cannot alloc memory");
+            slab->next = slabs_;
+            slabs_ = slab;
+            nextCell_ = slab->cells;
+            slabEnd_ = slab->cells + kCellsPerSlab;
+        }
+        return nextCell_++;
+    }
+
+    void Free(void* memory) noexcept {
+        auto* cell = static_cast<Cell*>(memory);
+        std::lock_guard<SpinLock> guard(lock_);
+        cell->next = freeList_;
+        freeList_ = cell;
+    }
+
+    size_t SlabCountForTests() noexcept {
+        std::lock_guard<SpinLock> guard(lock_);
+        size_t count = 0;
+        for (Slab* slab = slabs_; slab != nullptr; slab = slab->next) {
+            ++count;
+        }
+        return count;
+    }
+
+    static constexpr size_t CellsPerSlab() noexcept { return kCellsPerSlab; }
+
+private:
+    static_assert(kCellAlignment <= alignof(std::max_align_t), "Slabs are only aligned as malloc results are");
+
+    union Cell {
+        Cell* next;
+        alignas(kCellAlignment) unsigned char storage[kCellSize];
+    };
+
+    static constexpr size_t kSlabSize = 4096;
+    static constexpr size_t kCellsPerSlab = (kSlabSize - sizeof(Cell)) / sizeof(Cell);
+
+    struct Slab {
+        Slab* next;
+        Cell cells[kCellsPerSlab];
+    };
+
+    SpinLock lock_;
+    Cell* freeList_ = nullptr;
+    Cell* nextCell_ = nullptr;
+    Cell* slabEnd_ = nullptr;
+    Slab* slabs_ = nullptr;
+};
+
+} // namespace kotlin
+
+#endif // RUNTIME_FIXED_SIZE_POOL_H
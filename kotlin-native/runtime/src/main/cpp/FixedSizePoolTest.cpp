@@ -0,0 +1,102 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "FixedSizePool.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "TestSupport.hpp"
+
+using namespace kotlin;
+
+namespace {
+
+struct Data {
+    uint64_t first;
+    uint64_t second;
+    uint32_t third;
+};
+
+using DataPool = FixedSizePool<sizeof(Data), alignof(Data)>;
+
+} // namespace
+
+TEST(FixedSizePoolTest, AllocateDistinctCells) {
+    DataPool pool;
+    constexpr size_t kCount = DataPool::CellsPerSlab() * 3;
+
+    std::set<void*> cells;
+    for (size_t i = 0; i < kCount; ++i) {
+        void* cell = pool.Allocate();
+        EXPECT_THAT(reinterpret_cast<uintptr_t>(cell) % alignof(Data), 0);
+        new (cell) Data{i, i, static_cast<uint32_t>(i)};
+        cells.insert(cell);
+    }
+
+    EXPECT_THAT(cells.size(), kCount);
+    EXPECT_THAT(pool.SlabCountForTests(), 3);
+    for (void* cell : cells) {
+        auto* data = static_cast<Data*>(cell);
+        EXPECT_THAT(data->second, data->first);
+        EXPECT_THAT(data->third, static_cast<uint32_t>(data->first));
+    }
+}
+
+TEST(FixedSizePoolTest, ReuseFreedCells) {
+    DataPool pool;
+
+    void* first = pool.Allocate();
+    void* second = pool.Allocate();
+    pool.Free(first);
+    pool.Free(second);
+
+    EXPECT_THAT(pool.Allocate(), second);
+    EXPECT_THAT(pool.Allocate(), first);
+    EXPECT_THAT(pool.Allocate(), testing::Not(testing::AnyOf(first, second)));
+    EXPECT_THAT(pool.SlabCountForTests(), 1);
+}
+
+TEST(FixedSizePoolTest, ConcurrentAllocateAndFree) {
+    DataPool pool;
+    constexpr int kThreadCount = kDefaultThreadCount;
+    constexpr size_t kCount = 10000;
+
+    std::atomic<bool> canStart(false);
+    std::atomic<size_t> corruptedCount(0);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreadCount; ++i) {
+        threads.emplace_back([i, &pool, &canStart, &corruptedCount]() {
+            while (!canStart) {
+            }
+            std::vector<Data*> cells;
+            for (int round = 0; round < 3; ++round) {
+                for (size_t j = 0; j < kCount; ++j) {
+                    cells.push_back(new (pool.Allocate()) Data{static_cast<uint64_t>(i), j, 0});
+                }
+                for (size_t j = 0; j < kCount; ++j) {
+                    if (cells[j]->first != static_cast<uint64_t>(i) || cells[j]->second != j) ++corruptedCount;
+                    pool.Free(cells[j]);
+                }
+                cells.clear();
+            }
+        });
+    }
+    canStart = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_THAT(corruptedCount.load(), 0);
+    // Later rounds only reuse cells freed by earlier ones.
+    EXPECT_THAT(pool.SlabCountForTests(), testing::Le(kThreadCount * kCount / DataPool::CellsPerSlab() + kThreadCount));
+}
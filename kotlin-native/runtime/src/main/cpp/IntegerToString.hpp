@@ -0,0 +1,137 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_INTEGER_TO_STRING_H
+#define RUNTIME_INTEGER_TO_STRING_H
+
+#include <cstdint>
+#include <type_traits>
+
+namespace kotlin {
+
+namespace internal {
+
+constexpr char kDigits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+constexpr char kDigitPairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+// 10^i, except for 0 in place of 1, so that zero has one digit too.
+constexpr uint64_t kDigitCountThresholds[] = {
+        0,
+        10ull,
+        100ull,
+        1000ull,
+        10000ull,
+        100000ull,
+        1000000ull,
+        10000000ull,
+        100000000ull,
+        1000000000ull,
+        10000000000ull,
+        100000000000ull,
+        1000000000000ull,
+        10000000000000ull,
+        100000000000000ull,
+        1000000000000000ull,
+        10000000000000000ull,
+        100000000000000000ull,
+        1000000000000000000ull,
+        10000000000000000000ull,
+};
+
+// Int and smaller values are formatted with 32-bit division, which is much cheaper than the 64-bit one.
+template <typename T>
+using Magnitude = std::conditional_t<sizeof(T) <= sizeof(uint32_t), uint32_t, uint64_t>;
+
+template <typename T>
+inline Magnitude<T> MagnitudeOf(T value) noexcept {
+    Magnitude<T> magnitude = static_cast<Magnitude<T>>(value);
+    return value < 0 ? 0 - magnitude : magnitude;
+}
+
+inline uint32_t DecimalDigitCount(uint64_t value) noexcept {
+    // floor(log10(2) * bit length) is either the number of digits, or one less.
+    uint32_t guess = ((64 - __builtin_clzll(value | 1)) * 1233) >> 12;
+    return guess + (value >= kDigitCountThresholds[guess]);
+}
+
+// Writes digits of `value` right to left, two at a time, ending just before `end`.
+template <typename U, typename Char>
+inline void WriteDecimalDigits(U value, Char* end) noexcept {
+    while (value >= 100) {
+        const char* pair = kDigitPairs + (value % 100) * 2;
+        value /= 100;
+        *--end = pair[1];
+        *--end = pair[0];
+    }
+    if (value >= 10) {
+        const char* pair = kDigitPairs + value * 2;
+        *--end = pair[1];
+        *--end = pair[0];
+    } else {
+        *--end = '0' + value;
+    }
+}
+
+} // namespace internal
+
+// Long.MIN_VALUE in binary with its sign.
+constexpr uint32_t kMaxIntegerStringLength = 65;
+
+// Number of chars in the decimal representation of `value`, including the sign.
+template <typename T>
+inline uint32_t DecimalLength(T value) noexcept {
+    static_assert(std::is_integral_v<T> && std::is_signed_v<T>, "Only signed integers are supported");
+    return internal::DecimalDigitCount(internal::MagnitudeOf(value)) + (value < 0);
+}
+
+// Writes the decimal representation of `value` into the first `length` chars of `buffer`,
+// `length` must be `DecimalLength(value)`.
+template <typename T, typename Char>
+inline void WriteDecimal(T value, Char* buffer, uint32_t length) noexcept {
+    if (value < 0) *buffer = '-';
+    internal::WriteDecimalDigits(internal::MagnitudeOf(value), buffer + length);
+}
+
+// Writes the representation of `value` in `radix` between 2 and 36 with lowercase digits right to left,
+// ending just before `end`. `end` must follow at least kMaxIntegerStringLength chars. Returns the first char written.
+template <typename T, typename Char>
+inline Char* WriteRadixBackwards(T value, uint32_t radix, Char* end) noexcept {
+    static_assert(std::is_integral_v<T> && std::is_signed_v<T>, "Only signed integers are supported");
+    auto magnitude = internal::MagnitudeOf(value);
+    Char* current = end;
+    if (radix == 10) {
+        current -= internal::DecimalDigitCount(magnitude);
+        internal::WriteDecimalDigits(magnitude, end);
+    } else if ((radix & (radix - 1)) == 0) {
+        uint32_t shift = __builtin_ctz(radix);
+        uint32_t mask = radix - 1;
+        do {
+            *--current = internal::kDigits[magnitude & mask];
+            magnitude >>= shift;
+        } while (magnitude != 0);
+    } else {
+        do {
+            *--current = internal::kDigits[magnitude % radix];
+            magnitude /= radix;
+        } while (magnitude != 0);
+    }
+    if (value < 0) *--current = '-';
+    return current;
+}
+
+} // namespace kotlin
+
+#endif // RUNTIME_INTEGER_TO_STRING_H
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "IntegerToString.hpp"
+
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "Types.h"
+
+using namespace kotlin;
+
+namespace {
+
+template <typename T>
+std::string Decimal(T value) {
+    KChar chars[kMaxIntegerStringLength];
+    uint32_t length = DecimalLength(value);
+    WriteDecimal(value, chars, length);
+    return std::string(chars, chars + length);
+}
+
+template <typename T>
+std::string Radix(T value, uint32_t radix) {
+    KChar chars[kMaxIntegerStringLength];
+    KChar* end = chars + kMaxIntegerStringLength;
+    return std::string(WriteRadixBackwards(value, radix, end), end);
+}
+
+// Reference implementation, one digit at a time.
+std::string Expected(int64_t value, uint32_t radix) {
+    if (value == 0) return "0";
+    std::string result;
+    uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : value;
+    for (; magnitude != 0; magnitude /= radix) {
+        result.insert(result.begin(), "0123456789abcdefghijklmnopqrstuvwxyz"[magnitude % radix]);
+    }
+    return value < 0 ? "-" + result : result;
+}
+
+template <typename T>
+KStdVector<T> Values() {
+    KStdVector<T> values = {0, 1, -1, 9, 10, 11, 99, 100, 101, std::numeric_limits<T>::min(), std::numeric_limits<T>::max()};
+    // Powers of ten and their neighbours, where the digit count changes.
+    for (T power = 10; power <= std::numeric_limits<T>::max() / 10; power *= 10) {
+        for (T value : {T(power - 1), power, T(power + 1), T(power * 10 - 1)}) {
+            values.push_back(value);
+            values.push_back(-value);
+        }
+    }
+    std::mt19937_64 random(42);
+    for (int i = 0; i < 10000; ++i) {
+        // Random magnitudes, not only huge ones.
+        values.push_back(static_cast<T>(random() >> (random() % (sizeof(uint64_t) * 8))));
+        values.push_back(static_cast<T>(random()));
+    }
+    return values;
+}
+
+} // namespace
+
+template <typename T>
+class IntegerToStringTest : public testing::Test {};
+
+using IntegerTypes = testing::Types<KByte, KShort, KInt, KLong>;
+TYPED_TEST_SUITE(IntegerToStringTest, IntegerTypes);
+
+TYPED_TEST(IntegerToStringTest, Decimal) {
+    for (TypeParam value : Values<TypeParam>()) {
+        EXPECT_THAT(Decimal(value), Expected(value, 10));
+        EXPECT_THAT(DecimalLength(value), Expected(value, 10).size());
+    }
+}
+
+TYPED_TEST(IntegerToStringTest, Radix) {
+    for (uint32_t radix = 2; radix <= 36; ++radix) {
+        for (TypeParam value : Values<TypeParam>()) {
+            EXPECT_THAT(Radix(value, radix), Expected(value, radix)) << "radix " << radix;
+        }
+    }
+}
+
+TEST(IntegerToStringTest, Extremes) {
+    EXPECT_THAT(Decimal(std::numeric_limits<KLong>::min()), "-9223372036854775808");
+    EXPECT_THAT(Decimal(std::numeric_limits<KInt>::min()), "-2147483648");
+    EXPECT_THAT(Radix(std::numeric_limits<KLong>::min(), 2), "-1" + std::string(63, '0'));
+    EXPECT_THAT(Radix(std::numeric_limits<KLong>::max(), 36), "1y2p0ij32e8e7");
+}
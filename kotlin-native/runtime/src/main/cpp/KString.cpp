@@ -17,6 +17,8 @@
 #include <limits>
 #include <string.h>
 
+#include "CharProperties.hpp"
+#include "IntegerToString.hpp"
 #include "KAssert.h"
 #include "Exceptions.h"
 #include "Memory.h"
@@ -63,32 +65,35 @@ OBJ_GETTER(unsafeUtf16ToUtf8Impl, KString thiz, KInt start, KInt size) {
   RETURN_OBJ(result->obj());
 }
 
+bool g_internStringsOnDecode = false;
+
+// Decoded strings are only interned on request, see `Platform.isStringInterningOnDecodeActive`.
+template<utf8to16 conversion>
+OBJ_GETTER(utf8ToUtf16MaybeInterned, const char* rawString, const char* end, uint32_t charCount) {
+  if (!g_internStringsOnDecode) {
+    RETURN_RESULT_OF(utf8ToUtf16Impl<conversion>, rawString, end, charCount);
+  }
+  ObjHolder holder;
+  ObjHeader* result = utf8ToUtf16Impl<conversion>(rawString, end, charCount, holder.slot());
+  if (result == nullptr) RETURN_OBJ(nullptr);
+  RETURN_RESULT_OF(InternString, result);
+}
+
 OBJ_GETTER(utf8ToUtf16OrThrow, const char* rawString, size_t rawStringLength) {
   const char* end = rawString + rawStringLength;
   uint32_t charCount;
   TRY_CATCH(charCount = utf8::utf16_length(rawString, end),
             charCount = utf8::unchecked::utf16_length(rawString, end),
             ThrowCharacterCodingException());
-  RETURN_RESULT_OF(utf8ToUtf16Impl<utf8::unchecked::utf8to16>, rawString, end, charCount);
+  RETURN_RESULT_OF(utf8ToUtf16MaybeInterned<utf8::unchecked::utf8to16>, rawString, end, charCount);
 }
 
 OBJ_GETTER(utf8ToUtf16, const char* rawString, size_t rawStringLength) {
   const char* end = rawString + rawStringLength;
   uint32_t charCount = utf8::with_replacement::utf16_length(rawString, end);
-  RETURN_RESULT_OF(utf8ToUtf16Impl<utf8::with_replacement::utf8to16>, rawString, end, charCount);
+  RETURN_RESULT_OF(utf8ToUtf16MaybeInterned<utf8::with_replacement::utf8to16>, rawString, end, charCount);
 }
 
-constexpr KChar digitKeys[] = {
-  0x30, 0x41, 0x61, 0x660, 0x6f0, 0x966, 0x9e6, 0xa66, 0xae6, 0xb66, 0xbe7, 0xc66, 0xce6, 0xd66, 0xe50, 0xed0, 0xf20, 0x1040, 0x1369, 0x17e0,
-  0x1810, 0xff10, 0xff21, 0xff41
-};
-
-constexpr KChar digitValues[] = {
-  0x39, 0x30, 0x5a, 0x37, 0x7a, 0x57, 0x669, 0x660, 0x6f9, 0x6f0, 0x96f, 0x966, 0x9ef, 0x9e6, 0xa6f, 0xa66, 0xaef, 0xae6, 0xb6f, 0xb66,
-  0xbef, 0xbe6, 0xc6f, 0xc66, 0xcef, 0xce6, 0xd6f, 0xd66, 0xe59, 0xe50, 0xed9, 0xed0, 0xf29, 0xf20, 0x1049, 0x1040, 0x1371, 0x1368, 0x17e9, 0x17e0,
-  0x1819, 0x1810, 0xff19, 0xff10, 0xff3a, 0xff17, 0xff5a, 0xff37
-};
-
 } // namespace
 
 extern "C" {
@@ -269,18 +274,18 @@ KInt Kotlin_StringBuilder_insertString(KRef builder, KInt distIndex, KString fro
 KInt Kotlin_StringBuilder_insertInt(KRef builder, KInt position, KInt value) {
   auto toArray = builder->array();
   RuntimeAssert(toArray->count_ >= static_cast<uint32_t>(11 + position), "must be true");
-  char cstring[12];
-  auto length = konan::snprintf(cstring, sizeof(cstring), "%d", value);
-  RuntimeAssert(length >= 0, "This should never happen"); // may be overkill
-  RuntimeAssert(static_cast<size_t>(length) < sizeof(cstring), "Unexpectedly large value"); // Can't be, but this is what sNprintf for
-  auto* from = &cstring[0];
-  auto* to = CharArrayAddressOfElementAt(toArray, position);
-  while (*from) {
-    *to++ = *from++;
-  }
-  return from - cstring;
+  uint32_t length = kotlin::DecimalLength(value);
+  kotlin::WriteDecimal(value, CharArrayAddressOfElementAt(toArray, position), length);
+  return length;
 }
 
+KInt Kotlin_StringBuilder_insertLong(KRef builder, KInt position, KLong value) {
+  auto toArray = builder->array();
+  RuntimeAssert(toArray->count_ >= static_cast<uint32_t>(20 + position), "must be true");
+  uint32_t length = kotlin::DecimalLength(value);
+  kotlin::WriteDecimal(value, CharArrayAddressOfElementAt(toArray, position), length);
+  return length;
+}
 
 KBoolean Kotlin_String_equals(KString thiz, KConstRef other) {
   if (other == nullptr || other->type_info() != theStringTypeInfo) return false;
@@ -302,9 +307,59 @@ KBoolean Kotlin_String_unsafeRangeEquals(KString thiz, KInt thizOffset, KString
   ) == 0;
 }
 
+KInt Kotlin_Char_getCategoryValue(KChar ch) {
+  return kotlin::CharPropertiesOf(ch).category;
+}
+
+KBoolean Kotlin_Char_isDefined(KChar ch) {
+  return kotlin::CharPropertiesOf(ch).category != kotlin::char_category::kUnassigned;
+}
+
+KBoolean Kotlin_Char_isLetter(KChar ch) {
+  return kotlin::IsLetterCategory(kotlin::CharPropertiesOf(ch).category);
+}
+
+KBoolean Kotlin_Char_isLetterOrDigit(KChar ch) {
+  uint8_t category = kotlin::CharPropertiesOf(ch).category;
+  return kotlin::IsLetterCategory(category) || category == kotlin::char_category::kDecimalDigitNumber;
+}
+
+KBoolean Kotlin_Char_isDigit(KChar ch) {
+  return kotlin::CharPropertiesOf(ch).category == kotlin::char_category::kDecimalDigitNumber;
+}
+
+KBoolean Kotlin_Char_isUpperCase(KChar ch) {
+  return kotlin::CharPropertiesOf(ch).category == kotlin::char_category::kUppercaseLetter;
+}
+
+KBoolean Kotlin_Char_isLowerCase(KChar ch) {
+  return kotlin::CharPropertiesOf(ch).category == kotlin::char_category::kLowercaseLetter;
+}
+
+KBoolean Kotlin_Char_isTitleCase(KChar ch) {
+  return kotlin::CharPropertiesOf(ch).category == kotlin::char_category::kTitlecaseLetter;
+}
+
+KBoolean Kotlin_Char_isWhitespace(KChar ch) {
+  return kotlin::CharPropertiesOf(ch).whitespace;
+}
+
+KChar Kotlin_Char_lowercaseChar(KChar ch) {
+  return static_cast<KChar>(ch + kotlin::CharPropertiesOf(ch).lowercaseDelta);
+}
+
+KChar Kotlin_Char_uppercaseChar(KChar ch) {
+  return static_cast<KChar>(ch + kotlin::CharPropertiesOf(ch).uppercaseDelta);
+}
+
+KChar Kotlin_Char_titlecaseChar(KChar ch) {
+  return static_cast<KChar>(ch + kotlin::CharPropertiesOf(ch).titlecaseDelta);
+}
+
+// As in Java: non-whitespace ISO control chars and format chars.
 KBoolean Kotlin_Char_isIdentifierIgnorable(KChar ch) {
-  RuntimeAssert(false, "Kotlin_Char_isIdentifierIgnorable() is not implemented");
-  return false;
+  return (ch <= 0x08) || (ch >= 0x0E && ch <= 0x1B) || (ch >= 0x7F && ch <= 0x9F) ||
+      kotlin::CharPropertiesOf(ch).category == kotlin::char_category::kFormat;
 }
 
 KBoolean Kotlin_Char_isISOControl(KChar ch) {
@@ -319,32 +374,9 @@ KBoolean Kotlin_Char_isLowSurrogate(KChar ch) {
   return ((ch & 0xfc00) == 0xdc00);
 }
 
-constexpr KInt digits[] = {
-  0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
-  -1, -1, -1, -1, -1, -1, -1,
-  10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
-  20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
-  30, 31, 32, 33, 34, 35,
-  -1, -1, -1, -1, -1, -1,
-  10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
-  20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
-  30, 31, 32, 33, 34, 35
-};
-
-// Based on Apache Harmony implementation.
 // Radix check is performed on the Kotlin side.
 KInt Kotlin_Char_digitOfChecked(KChar ch, KInt radix) {
-
-  KInt result = -1;
-  if (ch >= 0x30 /* 0 */ && ch <= 0x7a /* z */) {
-    result = digits[ch - 0x30];
-  } else {
-    int index = -1;
-    index = binarySearchRange(digitKeys, ARRAY_SIZE(digitKeys), ch);
-    if (index >= 0 && ch <= digitValues[index * 2]) {
-      result = ch - digitValues[index * 2 + 1];
-    }
-  }
+  KInt result = kotlin::CharPropertiesOf(ch).digit;
   if (result >= radix) return -1;
   return result;
 }
@@ -436,6 +468,18 @@ KInt Kotlin_String_lastIndexOfString(KString thiz, KString other, KInt fromIndex
   }
 }
 
+OBJ_GETTER(Kotlin_String_intern, KString thiz) {
+  RETURN_RESULT_OF(InternString, const_cast<ObjHeader*>(thiz->obj()));
+}
+
+KBoolean Konan_Platform_getStringInterningOnDecode() {
+  return g_internStringsOnDecode;
+}
+
+void Konan_Platform_setStringInterningOnDecode(KBoolean value) {
+  g_internStringsOnDecode = value;
+}
+
 KInt Kotlin_String_hashCode(KString thiz) {
   // TODO: consider caching strings hashes.
   return polyHash(thiz->count_, CharArrayAddressOfElementAt(thiz, 0));
@@ -33,9 +33,9 @@ public:
     }
 
     void unlock() noexcept {
-        if (!__sync_bool_compare_and_swap(&atomicInt, 1, 0)) {
-            RuntimeAssert(false, "Unable to unlock");
-        }
+        RuntimeAssert(__atomic_load_n(&atomicInt, __ATOMIC_RELAXED) == 1, "Unable to unlock");
+        // Only the owner writes here, a release store is enough and is much cheaper than another CAS.
+        __atomic_store_n(&atomicInt, 0, __ATOMIC_RELEASE);
     }
 
 private:
@@ -0,0 +1,237 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_PRIMITIVE_ARRAY_SORT_H
+#define RUNTIME_PRIMITIVE_ARRAY_SORT_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#ifndef KONAN_NO_THREADS
+#include <atomic>
+#include <pthread.h>
+#include <thread>
+#endif
+
+#include "Alloc.h"
+
+namespace kotlin {
+
+namespace internal {
+
+constexpr int kRadixBits = 8;
+constexpr size_t kRadixSize = 1 << kRadixBits;
+
+// Below this size comparison sorting beats clearing and summing the radix histograms.
+constexpr size_t kSmallSortThreshold = 256;
+
+// Below this size spawning threads costs more than it saves.
+constexpr size_t kParallelSortThreshold = 1 << 18;
+
+constexpr unsigned kMaxSortThreads = 8;
+
+// Maps primitives onto unsigned keys, whose natural order is the order of Kotlin `compareTo`:
+// signed integers get their sign bit flipped, floating point numbers are ordered by sign and magnitude,
+// so that -0.0 goes before 0.0. NaNs must be taken out before mapping.
+template <typename T>
+struct RadixKey {
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Only 32- and 64-bit primitives are supported");
+
+    using Key = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+    static constexpr Key kSignBit = Key(1) << (sizeof(Key) * 8 - 1);
+
+    static Key ToKey(T value) noexcept {
+        Key bits;
+        memcpy(&bits, &value, sizeof(Key));
+        if constexpr (std::is_floating_point_v<T>) {
+            return (bits & kSignBit) ? ~bits : bits ^ kSignBit;
+        } else {
+            return bits ^ kSignBit;
+        }
+    }
+
+    static T FromKey(Key key) noexcept {
+        Key bits;
+        if constexpr (std::is_floating_point_v<T>) {
+            bits = (key & kSignBit) ? key ^ kSignBit : ~key;
+        } else {
+            bits = key ^ kSignBit;
+        }
+        T value;
+        memcpy(&value, &bits, sizeof(Key));
+        return value;
+    }
+};
+
+template <typename Key>
+inline size_t Digit(Key key, int digit) noexcept {
+    return (key >> (digit * kRadixBits)) & (kRadixSize - 1);
+}
+
+// Number of low digits that differ between `keys`: higher digits are the same for every key and need no pass.
+template <typename Key>
+int VaryingDigits(const Key* keys, size_t size) noexcept {
+    Key anyBits = 0;
+    Key allBits = ~Key(0);
+    for (size_t i = 0; i < size; ++i) {
+        anyBits |= keys[i];
+        allBits &= keys[i];
+    }
+    int digits = 0;
+    for (Key varying = anyBits ^ allBits; varying != 0; varying >>= kRadixBits) {
+        ++digits;
+    }
+    return digits;
+}
+
+// Least significant digit first radix sort of `size` keys by their `digits` low digits, `scratch` must hold `size` keys.
+// Histograms of all digits are collected in a single pass, and passes where every key falls into the same bucket are
+// skipped. Returns whichever of `keys` and `scratch` holds the result.
+template <typename Key>
+Key* RadixSortLsd(Key* keys, Key* scratch, size_t size, int digits) noexcept {
+    if (size <= kSmallSortThreshold) {
+        std::sort(keys, keys + size);
+        return keys;
+    }
+    uint32_t counts[sizeof(Key)][kRadixSize] = {};
+    for (size_t i = 0; i < size; ++i) {
+        Key key = keys[i];
+        // Counting all digits keeps the loop fully unrolled.
+        for (size_t digit = 0; digit < sizeof(Key); ++digit) {
+            ++counts[digit][Digit(key, digit)];
+        }
+    }
+    Key* from = keys;
+    Key* to = scratch;
+    for (int digit = 0; digit < digits; ++digit) {
+        uint32_t* offsets = counts[digit];
+        if (offsets[Digit(from[0], digit)] == size) continue;
+        uint32_t offset = 0;
+        for (size_t bucket = 0; bucket < kRadixSize; ++bucket) {
+            uint32_t count = offsets[bucket];
+            offsets[bucket] = offset;
+            offset += count;
+        }
+        for (size_t i = 0; i < size; ++i) {
+            Key key = from[i];
+            to[offsets[Digit(key, digit)]++] = key;
+        }
+        std::swap(from, to);
+    }
+    return from;
+}
+
+#ifndef KONAN_NO_THREADS
+
+// The start routine of a sort thread. pthreads report failures to start a thread by return values, while
+// `std::thread` throws, which would terminate the runtime when it is built without exceptions.
+template <typename Worker>
+void* RunSortWorker(void* worker) noexcept {
+    (*static_cast<Worker*>(worker))();
+    return nullptr;
+}
+
+// Splits keys into buckets by their highest varying digit, then sorts the buckets by the remaining digits on
+// `threadCount` threads. Returns whichever of `keys` and `scratch` holds the result.
+template <typename Key>
+Key* RadixSortParallel(Key* keys, Key* scratch, size_t size, unsigned threadCount) noexcept {
+    int digits = VaryingDigits(keys, size);
+    if (digits == 0) return keys;
+    int topDigit = digits - 1;
+
+    size_t offsets[kRadixSize + 1] = {};
+    for (size_t i = 0; i < size; ++i) {
+        ++offsets[Digit(keys[i], topDigit) + 1];
+    }
+    for (size_t bucket = 0; bucket < kRadixSize; ++bucket) {
+        offsets[bucket + 1] += offsets[bucket];
+    }
+    size_t next[kRadixSize];
+    std::copy(offsets, offsets + kRadixSize, next);
+    for (size_t i = 0; i < size; ++i) {
+        Key key = keys[i];
+        scratch[next[Digit(key, topDigit)]++] = key;
+    }
+
+    // Keys now live in `scratch`, and each bucket uses the same range of `keys` as its scratch space.
+    std::atomic<size_t> nextBucket(0);
+    auto worker = [&]() noexcept {
+        for (size_t bucket; (bucket = nextBucket.fetch_add(1, std::memory_order_relaxed)) < kRadixSize;) {
+            size_t begin = offsets[bucket];
+            size_t bucketSize = offsets[bucket + 1] - begin;
+            Key* sorted = RadixSortLsd(scratch + begin, keys + begin, bucketSize, topDigit);
+            if (sorted != scratch + begin) {
+                memcpy(scratch + begin, sorted, bucketSize * sizeof(Key));
+            }
+        }
+    };
+    pthread_t threads[kMaxSortThreads];
+    unsigned startedCount = 1;
+    for (; startedCount < threadCount; ++startedCount) {
+        // Buckets are claimed one by one, so if a thread can't be started, the threads that did start, this one
+        // included, sort all of them.
+        if (pthread_create(&threads[startedCount], nullptr, RunSortWorker<decltype(worker)>, &worker) != 0) break;
+    }
+    worker();
+    for (unsigned i = 1; i < startedCount; ++i) {
+        pthread_join(threads[i], nullptr);
+    }
+    return scratch;
+}
+
+#endif // !KONAN_NO_THREADS
+
+} // namespace internal
+
+// Sorts `size` primitives into the order of Kotlin `compareTo`: NaNs go last, -0.0 goes before 0.0.
+// Elements are sorted with a radix sort, in place with a temporary buffer of the same size.
+// `parallel` allows using worker threads for large arrays; the calling thread waits for them.
+template <typename T>
+void SortPrimitives(T* values, size_t size, bool parallel = false) noexcept {
+    using Traits = internal::RadixKey<T>;
+    using Key = typename Traits::Key;
+    static_assert(sizeof(Key) == sizeof(T), "Keys are stored in place of values");
+
+    if constexpr (std::is_floating_point_v<T>) {
+        // NaNs are equal to each other and greater than anything else, so just move them to the end.
+        size = std::partition(values, values + size, [](T value) { return !std::isnan(value); }) - values;
+    }
+    if (size < 2) return;
+
+    Key* keys = reinterpret_cast<Key*>(values);
+    for (size_t i = 0; i < size; ++i) {
+        Key key = Traits::ToKey(values[i]);
+        memcpy(&keys[i], &key, sizeof(Key));
+    }
+
+    // Small arrays are sorted in place and need no scratch buffer.
+    Key* scratch = size > internal::kSmallSortThreshold ? konanAllocArray<Key>(size) : nullptr;
+    Key* sorted = nullptr;
+#ifndef KONAN_NO_THREADS
+    unsigned threadCount = parallel ? std::min(std::thread::hardware_concurrency(), internal::kMaxSortThreads) : 1;
+    if (threadCount > 1 && size >= internal::kParallelSortThreshold) {
+        sorted = internal::RadixSortParallel(keys, scratch, size, threadCount);
+    }
+#endif
+    if (sorted == nullptr) {
+        sorted = internal::RadixSortLsd(keys, scratch, size, sizeof(Key));
+    }
+    for (size_t i = 0; i < size; ++i) {
+        values[i] = Traits::FromKey(sorted[i]);
+    }
+    if (scratch != nullptr) {
+        konanFreeMemory(scratch);
+    }
+}
+
+} // namespace kotlin
+
+#endif // RUNTIME_PRIMITIVE_ARRAY_SORT_H
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "PrimitiveArraySort.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "Types.h"
+
+using namespace kotlin;
+
+namespace {
+
+// Kotlin `compareTo` order: -0.0 before 0.0, NaNs last.
+template <typename T>
+bool CompareTo(T lhs, T rhs) {
+    if constexpr (std::is_floating_point_v<T>) {
+        if (std::isnan(lhs)) return false;
+        if (std::isnan(rhs)) return true;
+        if (lhs == 0 && rhs == 0) return std::signbit(lhs) && !std::signbit(rhs);
+    }
+    return lhs < rhs;
+}
+
+template <typename T>
+KStdVector<T> RandomValues(size_t size, std::mt19937_64& random) {
+    KStdVector<T> values(size);
+    for (auto& value : values) {
+        if constexpr (std::is_floating_point_v<T>) {
+            switch (random() % 8) {
+                case 0: value = std::numeric_limits<T>::quiet_NaN(); break;
+                case 1: value = -std::numeric_limits<T>::quiet_NaN(); break;
+                case 2: value = random() % 2 ? 0.0 : -0.0; break;
+                case 3: value = random() % 2 ? std::numeric_limits<T>::infinity() : -std::numeric_limits<T>::infinity(); break;
+                default: value = static_cast<T>(static_cast<int64_t>(random())) / 1e6; break;
+            }
+        } else {
+            value = static_cast<T>(random());
+        }
+    }
+    return values;
+}
+
+template <typename T>
+void ExpectSortedLikeKotlin(KStdVector<T> values, bool parallel) {
+    KStdVector<T> expected = values;
+    std::stable_sort(expected.begin(), expected.end(), CompareTo<T>);
+    SortPrimitives(values.data(), values.size(), parallel);
+    ASSERT_THAT(values.size(), expected.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(expected[i])) {
+                EXPECT_TRUE(std::isnan(values[i])) << "at " << i;
+                continue;
+            }
+        }
+        EXPECT_THAT(std::memcmp(&values[i], &expected[i], sizeof(T)), 0) << "at " << i;
+    }
+}
+
+template <typename T>
+class PrimitiveArraySortTest : public testing::Test {};
+
+using PrimitiveTypes = testing::Types<KInt, KLong, KFloat, KDouble>;
+TYPED_TEST_SUITE(PrimitiveArraySortTest, PrimitiveTypes);
+
+} // namespace
+
+TYPED_TEST(PrimitiveArraySortTest, Empty) {
+    SortPrimitives<TypeParam>(nullptr, 0);
+}
+
+TYPED_TEST(PrimitiveArraySortTest, Sizes) {
+    std::mt19937_64 random(42);
+    for (size_t size : {1, 2, 3, 17, 255, 256, 257, 1000, 100000}) {
+        ExpectSortedLikeKotlin(RandomValues<TypeParam>(size, random), false);
+    }
+}
+
+TYPED_TEST(PrimitiveArraySortTest, NarrowRange) {
+    std::mt19937_64 random(42);
+    KStdVector<TypeParam> values(10000);
+    for (auto& value : values) {
+        value = static_cast<TypeParam>(static_cast<int>(random() % 1000) - 500);
+    }
+    ExpectSortedLikeKotlin(values, false);
+    ExpectSortedLikeKotlin(values, true);
+}
+
+TYPED_TEST(PrimitiveArraySortTest, SameValues) {
+    ExpectSortedLikeKotlin(KStdVector<TypeParam>(1000, 7), false);
+    ExpectSortedLikeKotlin(KStdVector<TypeParam>(1 << 19, 7), true);
+}
+
+TYPED_TEST(PrimitiveArraySortTest, Parallel) {
+    std::mt19937_64 random(42);
+    ExpectSortedLikeKotlin(RandomValues<TypeParam>(1 << 19, random), true);
+}
+
+TYPED_TEST(PrimitiveArraySortTest, ParallelBuckets) {
+    using Key = typename kotlin::internal::RadixKey<TypeParam>::Key;
+    std::mt19937_64 random(42);
+    for (int shift : {0, 20, 40}) {
+        KStdVector<Key> keys(100000);
+        for (auto& key : keys) {
+            key = static_cast<Key>(random() >> shift);
+        }
+        KStdVector<Key> expected = keys;
+        std::sort(expected.begin(), expected.end());
+        KStdVector<Key> scratch(keys.size());
+        Key* sorted = kotlin::internal::RadixSortParallel(keys.data(), scratch.data(), keys.size(), 4);
+        EXPECT_THAT(KStdVector<Key>(sorted, sorted + keys.size()), testing::ElementsAreArray(expected));
+    }
+}
@@ -1,5 +1,6 @@
 #include <cstring>
 #include "Types.h"
+#include "CodePointTable.hpp"
 #include "KString.h"
 #include "Natives.h"
 
@@ -540,20 +541,34 @@ constexpr Decomposition decompositionValues[] = {
   {{40709}, 1}, {{40719}, 1}, {{40726}, 1}, {{40763}, 1}, {{173568}, 1}
 };
 
+static_assert(ARRAY_SIZE(decompositionKeys) == ARRAY_SIZE(decompositionValues), "Decomposition tables must match");
+static_assert(ARRAY_SIZE(canonicalClassesKeys) == ARRAY_SIZE(canonicalClassesValues), "Canonical class tables must match");
+
+// Lookup tables over the sorted arrays above, built at compile time.
+constexpr kotlin::CodePointTable<uint8_t, canonicalClassesKeys> canonicalClasses([](size_t index) {
+  return static_cast<uint8_t>(canonicalClassesValues[index]);
+});
+
+// Index of the decomposition plus one, zero if there is none.
+constexpr kotlin::CodePointTable<uint16_t, decompositionKeys> decompositionIndices([](size_t index) {
+  return static_cast<uint16_t>(index + 1);
+});
+
+constexpr kotlin::CodePointSet<singleDecompositions> singleDecompositionSet;
+
+// Nothing below it, that is ASCII and most of Latin-1, decomposes.
+constexpr KInt firstDecomposableCodePoint = decompositionKeys[0];
+
 KInt getCanonicalClass(KInt ch) {
-  int index = binarySearchRange(canonicalClassesKeys, ARRAY_SIZE(canonicalClassesKeys), ch);
-  if (canonicalClassesKeys[index] != ch) {
-    return 0;
-  }
-  return canonicalClassesValues[index];
+  return canonicalClasses[ch];
 }
 
 const Decomposition* getDecomposition(KInt codePoint) {
-  int index = binarySearchRange(decompositionKeys, ARRAY_SIZE(decompositionKeys), codePoint);
-  if (decompositionKeys[index] != codePoint) {
+  if (codePoint < firstDecomposableCodePoint) {
     return nullptr;
   }
-  return &decompositionValues[index];
+  uint16_t index = decompositionIndices[codePoint];
+  return index == 0 ? nullptr : &decompositionValues[index - 1];
 }
 
 } // namespace
@@ -565,8 +580,7 @@ KInt Kotlin_text_regex_getCanonicalClassInternal(KInt ch) {
 }
 
 KBoolean Kotlin_text_regex_hasSingleCodepointDecompositionInternal(KInt ch) {
-  int index = binarySearchRange(singleDecompositions, ARRAY_SIZE(singleDecompositions), ch);
-  return singleDecompositions[index] == ch;
+  return singleDecompositionSet.contains(ch);
 }
 
 OBJ_GETTER(Kotlin_text_regex_getDecompositionInternal, KInt ch) {
@@ -594,6 +608,10 @@ KInt Kotlin_text_regex_decomposeString(ArrayHeader* inputCodePoints, KInt inputL
   const KInt* inputArray = IntArrayAddressOfElementAt(inputCodePoints, 0);
   KInt* outputArray = IntArrayAddressOfElementAt(outputCodePoints, 0);
   for (int i = 0; i < inputLength; i++) {
+    if (inputArray[i] < firstDecomposableCodePoint) {
+      outputArray[outputLength++] = inputArray[i];
+      continue;
+    }
     const Decomposition* decomposition = getDecomposition(inputArray[i]);
     if (decomposition == nullptr) {
       outputArray[outputLength++] = inputArray[i];
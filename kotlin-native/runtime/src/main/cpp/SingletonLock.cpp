@@ -0,0 +1,109 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "SingletonLock.hpp"
+
+#if !KONAN_NO_THREADS
+
+#include <cstdint>
+#include <pthread.h>
+
+using namespace kotlin;
+
+namespace {
+
+// Most singletons are initialized quickly, so waiting threads don't sleep right away.
+constexpr int kSpinIterations = 1000;
+
+// Threads waiting for different singletons may share a bucket, and then wake up needlessly.
+constexpr size_t kWaitBucketCount = 64;
+
+struct WaitBucket {
+    pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t condition = PTHREAD_COND_INITIALIZER;
+    // Number of threads sleeping or about to sleep on `condition`.
+    int32_t waiters = 0;
+};
+
+WaitBucket waitBuckets[kWaitBucketCount];
+
+WaitBucket& WaitBucketFor(ObjHeader** location) noexcept {
+    return waitBuckets[(reinterpret_cast<uintptr_t>(location) / sizeof(ObjHeader*)) % kWaitBucketCount];
+}
+
+// Reads `location` before trying to take it, so that waiting threads don't write the cache line.
+bool TryLockSingletonOnce(ObjHeader** location, ObjHeader*& value) noexcept {
+    value = __atomic_load_n(location, __ATOMIC_ACQUIRE);
+    if (value == nullptr) {
+        value = __sync_val_compare_and_swap(location, nullptr, kInitializingSingleton);
+    }
+    return value != kInitializingSingleton;
+}
+
+} // namespace
+
+bool kotlin::TryLockSingleton(ObjHeader** location, ObjHeader*& value) noexcept {
+    for (int i = 0; i < kSpinIterations; ++i) {
+        if (TryLockSingletonOnce(location, value)) return true;
+    }
+    return false;
+}
+
+ObjHeader* kotlin::WaitForSingleton(ObjHeader** location) noexcept {
+    ObjHeader* value = nullptr;
+    auto& bucket = WaitBucketFor(location);
+    pthread_mutex_lock(&bucket.mutex);
+    // Registered before checking `location` again, so that the initializing thread either sees the waiter, or
+    // has already replaced the marker. Pairs with the fence in `WakeSingletonWaiters`.
+    __atomic_add_fetch(&bucket.waiters, 1, __ATOMIC_SEQ_CST);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    while (!TryLockSingletonOnce(location, value)) {
+        pthread_cond_wait(&bucket.condition, &bucket.mutex);
+    }
+    __atomic_sub_fetch(&bucket.waiters, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&bucket.mutex);
+    return value;
+}
+
+ObjHeader* kotlin::LockSingleton(ObjHeader** location) noexcept {
+    ObjHeader* value = nullptr;
+    if (TryLockSingleton(location, value)) return value;
+    return WaitForSingleton(location);
+}
+
+void kotlin::WakeSingletonWaiters(ObjHeader** location) noexcept {
+    auto& bucket = WaitBucketFor(location);
+    // Orders the store to `location` before reading the number of waiters.
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&bucket.waiters, __ATOMIC_SEQ_CST) == 0) return;
+    pthread_mutex_lock(&bucket.mutex);
+    pthread_cond_broadcast(&bucket.condition);
+    pthread_mutex_unlock(&bucket.mutex);
+}
+
+#else // !KONAN_NO_THREADS
+
+bool kotlin::TryLockSingleton(ObjHeader** location, ObjHeader*& value) noexcept {
+    value = *location;
+    if (value == nullptr) *location = kInitializingSingleton;
+    // With a single thread, a singleton being initialized can only be taken by the initializing thread.
+    return true;
+}
+
+ObjHeader* kotlin::WaitForSingleton(ObjHeader** location) noexcept {
+    ObjHeader* value = nullptr;
+    TryLockSingleton(location, value);
+    return value;
+}
+
+ObjHeader* kotlin::LockSingleton(ObjHeader** location) noexcept {
+    ObjHeader* value = nullptr;
+    TryLockSingleton(location, value);
+    return value;
+}
+
+void kotlin::WakeSingletonWaiters(ObjHeader** location) noexcept {}
+
+#endif // !KONAN_NO_THREADS
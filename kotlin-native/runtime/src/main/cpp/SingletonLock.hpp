@@ -0,0 +1,30 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_SINGLETON_LOCK_H
+#define RUNTIME_SINGLETON_LOCK_H
+
+#include "Memory.h"
+
+namespace kotlin {
+
+// Takes `location` of a shared singleton for initialization: returns nullptr if the caller must initialize the
+// singleton and store the value, or the value if the singleton is initialized already. While another thread is
+// initializing the singleton, spins for a while and then sleeps until `WakeSingletonWaiters` is called.
+ObjHeader* LockSingleton(ObjHeader** location) noexcept;
+
+// The two halves of `LockSingleton`, for callers that must prepare for sleeping. `TryLockSingleton` spins for a
+// while and returns false if another thread is still initializing the singleton, then `WaitForSingleton` sleeps
+// until it is done and returns what `LockSingleton` would.
+bool TryLockSingleton(ObjHeader** location, ObjHeader*& value) noexcept;
+ObjHeader* WaitForSingleton(ObjHeader** location) noexcept;
+
+// Must be called after the initializing thread replaces kInitializingSingleton at `location` either with the
+// value or with nullptr, if the initialization failed.
+void WakeSingletonWaiters(ObjHeader** location) noexcept;
+
+} // namespace kotlin
+
+#endif // RUNTIME_SINGLETON_LOCK_H
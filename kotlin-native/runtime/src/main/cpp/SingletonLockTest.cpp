@@ -0,0 +1,88 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "SingletonLock.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "TestSupport.hpp"
+#include "Types.h"
+
+using namespace kotlin;
+
+namespace {
+
+ObjHeader* const kValue = reinterpret_cast<ObjHeader*>(0x1000);
+
+} // namespace
+
+TEST(SingletonLockTest, LockUninitialized) {
+    ObjHeader* location = nullptr;
+    EXPECT_THAT(LockSingleton(&location), nullptr);
+    EXPECT_THAT(location, kInitializingSingleton);
+}
+
+TEST(SingletonLockTest, LockInitialized) {
+    ObjHeader* location = kValue;
+    EXPECT_THAT(LockSingleton(&location), kValue);
+    EXPECT_THAT(location, kValue);
+}
+
+TEST(SingletonLockTest, WaitForSlowInitialization) {
+    constexpr size_t kThreadCount = kDefaultThreadCount;
+    ObjHeader* location = kInitializingSingleton;
+    std::atomic<size_t> readyCount(0);
+    KStdVector<ObjHeader*> actual(kThreadCount, nullptr);
+    KStdVector<std::thread> threads;
+    for (size_t i = 0; i < kThreadCount; ++i) {
+        threads.emplace_back([i, &location, &actual, &readyCount]() {
+            ++readyCount;
+            actual[i] = LockSingleton(&location);
+        });
+    }
+    while (readyCount < kThreadCount) {
+    }
+    // Long enough for the waiting threads to stop spinning and go to sleep.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    __atomic_store_n(&location, kValue, __ATOMIC_RELEASE);
+    WakeSingletonWaiters(&location);
+    for (auto& t : threads) {
+        t.join();
+    }
+    EXPECT_THAT(actual, testing::Each(kValue));
+}
+
+TEST(SingletonLockTest, WaitForFailedInitialization) {
+    constexpr size_t kThreadCount = kDefaultThreadCount;
+    ObjHeader* location = kInitializingSingleton;
+    std::atomic<size_t> readyCount(0);
+    std::atomic<size_t> lockedCount(0);
+    KStdVector<std::thread> threads;
+    for (size_t i = 0; i < kThreadCount; ++i) {
+        threads.emplace_back([&location, &readyCount, &lockedCount]() {
+            ++readyCount;
+            if (LockSingleton(&location) != nullptr) return;
+            // Fail the initialization again, so that the next waiting thread gets to initialize the singleton.
+            ++lockedCount;
+            __atomic_store_n(&location, nullptr, __ATOMIC_RELEASE);
+            WakeSingletonWaiters(&location);
+        });
+    }
+    while (readyCount < kThreadCount) {
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    __atomic_store_n(&location, nullptr, __ATOMIC_RELEASE);
+    WakeSingletonWaiters(&location);
+    for (auto& t : threads) {
+        t.join();
+    }
+    EXPECT_THAT(lockedCount.load(), kThreadCount);
+    EXPECT_THAT(location, nullptr);
+}
@@ -14,10 +14,10 @@
  * limitations under the License.
  */
 
-#include <limits.h>
 #include <stdio.h>
 #include <string.h>
 
+#include "IntegerToString.hpp"
 #include "KAssert.h"
 #include "Exceptions.h"
 #include "Memory.h"
@@ -28,41 +28,21 @@
 
 namespace {
 
-char int_to_digit(uint32_t value) {
-  if (value < 10) {
-    return '0' + value;
-  } else {
-    return 'a' + (value - 10);
-  }
+template <typename T> OBJ_GETTER(Kotlin_toStringDecimal, T value) {
+  uint32_t length = kotlin::DecimalLength(value);
+  ArrayHeader* result = AllocArrayInstance(theStringTypeInfo, length, OBJ_RESULT)->array();
+  kotlin::WriteDecimal(value, CharArrayAddressOfElementAt(result, 0), length);
+  RETURN_OBJ(result->obj());
 }
 
 // Radix is checked on the Kotlin side.
 template <typename T> OBJ_GETTER(Kotlin_toStringRadix, T value, KInt radix) {
-  if (value == 0) {
-    RETURN_RESULT_OF(CreateStringFromCString, "0");
-  }
-  // In the worst case, we convert to binary, with sign.
-  char cstring[sizeof(T) * CHAR_BIT + 2];
-  bool negative = (value < 0);
-  if  (!negative) {
-    value = -value;
-  }
-
-  int32_t length = 0;
-  while (value < 0) {
-    cstring[length++] = int_to_digit(-(value % radix));
-    value /= radix;
-  }
-  if (negative) {
-    cstring[length++] = '-';
-  }
-  for (int i = 0, j = length - 1; i < j; i++, j--) {
-    char tmp = cstring[i];
-    cstring[i] = cstring[j];
-    cstring[j] = tmp;
-  }
-  cstring[length] = '\0';
-  RETURN_RESULT_OF(CreateStringFromCString, cstring);
+  KChar chars[kotlin::kMaxIntegerStringLength];
+  KChar* end = chars + kotlin::kMaxIntegerStringLength;
+  KChar* begin = kotlin::WriteRadixBackwards(value, radix, end);
+  ArrayHeader* result = AllocArrayInstance(theStringTypeInfo, end - begin, OBJ_RESULT)->array();
+  memcpy(CharArrayAddressOfElementAt(result, 0), begin, (end - begin) * sizeof(KChar));
+  RETURN_OBJ(result->obj());
 }
 
 }  // namespace
@@ -70,9 +50,7 @@ template <typename T> OBJ_GETTER(Kotlin_toStringRadix, T value, KInt radix) {
 extern "C" {
 
 OBJ_GETTER(Kotlin_Byte_toString, KByte value) {
-  char cstring[8];
-  konan::snprintf(cstring, sizeof(cstring), "%d", value);
-  RETURN_RESULT_OF(CreateStringFromCString, cstring);
+  RETURN_RESULT_OF(Kotlin_toStringDecimal<KByte>, value);
 }
 
 OBJ_GETTER(Kotlin_Char_toString, KChar value) {
@@ -82,15 +60,11 @@ OBJ_GETTER(Kotlin_Char_toString, KChar value) {
 }
 
 OBJ_GETTER(Kotlin_Short_toString, KShort value) {
-  char cstring[8];
-  konan::snprintf(cstring, sizeof(cstring), "%d", value);
-  RETURN_RESULT_OF(CreateStringFromCString, cstring);
+  RETURN_RESULT_OF(Kotlin_toStringDecimal<KShort>, value);
 }
 
 OBJ_GETTER(Kotlin_Int_toString, KInt value) {
-  char cstring[16];
-  konan::snprintf(cstring, sizeof(cstring), "%d", value);
-  RETURN_RESULT_OF(CreateStringFromCString, cstring);
+  RETURN_RESULT_OF(Kotlin_toStringDecimal<KInt>, value);
 }
 
 OBJ_GETTER(Kotlin_Int_toStringRadix, KInt value, KInt radix) {
@@ -98,9 +72,7 @@ OBJ_GETTER(Kotlin_Int_toStringRadix, KInt value, KInt radix) {
 }
 
 OBJ_GETTER(Kotlin_Long_toString, KLong value) {
-  char cstring[32];
-  konan::snprintf(cstring, sizeof(cstring), "%lld", static_cast<long long>(value));
-  RETURN_RESULT_OF(CreateStringFromCString, cstring);
+  RETURN_RESULT_OF(Kotlin_toStringDecimal<KLong>, value);
 }
 
 OBJ_GETTER(Kotlin_Long_toStringRadix, KLong value, KInt radix) {
@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 
+#include <atomic>
+#include <cstdint>
+
 #include "KAssert.h"
 #include "TypeInfo.h"
 
@@ -21,10 +24,59 @@
 // TODO: maybe select strategy basing on number of elements.
 #define USE_BINARY_SEARCH 1
 
+namespace {
+
+inline int64_t KeyOf(const MethodTableRecord* record) {
+  return record->nameSignature_;
+}
+
+inline int64_t KeyOf(const InterfaceTableRecord* record) {
+  return record->id;
+}
+
+// Results of the table searches below are cached in direct-mapped caches, shared by all classes and threads.
+// A slot keeps just a pointer to the found record, which is validated on lookup: it must lie within the table and
+// have the requested key. A record passing that is the right answer no matter who stored it, so concurrent
+// overwrites need no synchronization.
+template <typename Record>
+class DispatchCache {
+public:
+  const Record* Find(const Record* table, uint32_t tableSize, int64_t key) noexcept {
+    const Record* record = slots_[slot(table, key)].load(std::memory_order_relaxed);
+    // Compared as addresses, as relational operators on pointers into different arrays are undefined. An address
+    // below the table wraps around to a large offset.
+    uintptr_t offset = reinterpret_cast<uintptr_t>(record) - reinterpret_cast<uintptr_t>(table);
+    if (offset < tableSize * sizeof(Record) && KeyOf(record) == key) return record;
+    return nullptr;
+  }
+
+  void Put(const Record* table, int64_t key, const Record* record) noexcept {
+    slots_[slot(table, key)].store(record, std::memory_order_relaxed);
+  }
+
+private:
+  static constexpr int kSlotBits = 10;
+
+  static size_t slot(const Record* table, int64_t key) noexcept {
+    uint64_t hash = (reinterpret_cast<uintptr_t>(table) >> 4) ^ static_cast<uint64_t>(key);
+    return (hash * 0x9E3779B97F4A7C15ull) >> (64 - kSlotBits);
+  }
+
+  std::atomic<const Record*> slots_[1 << kSlotBits] = {};
+};
+
+DispatchCache<MethodTableRecord> openMethodCache;
+DispatchCache<InterfaceTableRecord> interfaceTableCache;
+
+} // namespace
+
 extern "C" {
 #if USE_BINARY_SEARCH
 
 void* LookupOpenMethod(const TypeInfo* info, MethodNameHash nameSignature) {
+  if (auto* cached = openMethodCache.Find(info->openMethods_, info->openMethodsCount_, nameSignature)) {
+    return cached->methodEntryPoint_;
+  }
   int bottom = 0;
   int top = info->openMethodsCount_ - 1;
 
@@ -32,8 +84,10 @@ void* LookupOpenMethod(const TypeInfo* info, MethodNameHash nameSignature) {
     int middle = (bottom + top) / 2;
     if (info->openMethods_[middle].nameSignature_ < nameSignature)
       bottom = middle + 1;
-    else if (info->openMethods_[middle].nameSignature_ == nameSignature)
+    else if (info->openMethods_[middle].nameSignature_ == nameSignature) {
+      openMethodCache.Put(info->openMethods_, nameSignature, &info->openMethods_[middle]);
       return info->openMethods_[middle].methodEntryPoint_;
+    }
     else
       top = middle - 1;
   }
@@ -66,6 +120,9 @@ InterfaceTableRecord const* LookupInterfaceTableRecord(InterfaceTableRecord cons
     for (i = 0; i < interfaceTableSize - 1 && interfaceTable[i].id < interfaceId; ++i);
     return interfaceTable + i;
   }
+  if (auto* cached = interfaceTableCache.Find(interfaceTable, interfaceTableSize, interfaceId)) {
+    return cached;
+  }
   int l = 0, r = interfaceTableSize - 1;
   while (l < r) {
     int m = (l + r) / 2;
@@ -73,6 +130,10 @@ InterfaceTableRecord const* LookupInterfaceTableRecord(InterfaceTableRecord cons
       l = m + 1;
     else r = m;
   }
+  // Misses are not cached: a record with another id would fail validation anyway.
+  if (interfaceTable[l].id == interfaceId) {
+    interfaceTableCache.Put(interfaceTable, interfaceId, interfaceTable + l);
+  }
   return interfaceTable + l;
 }
 
@@ -73,6 +73,8 @@ enum Konan_TypeFlags {
 enum Konan_MetaFlags {
   // If freeze attempt happens on such an object - throw an exception.
   MF_NEVER_FROZEN = 1 << 0,
+  // Object is a string in the runtime intern table, it must be removed from there on destruction.
+  MF_INTERNED_STRING = 1 << 1,
 };
 
 // Extended information about a type.
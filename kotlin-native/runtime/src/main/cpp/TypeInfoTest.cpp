@@ -99,3 +99,67 @@ INSTANTIATE_TEST_SUITE_P(
 TEST_P(LayoutCompatibleTest, IsLayoutCompatible) {
     EXPECT_THAT(lhsType()->IsLayoutCompatible(rhsType()), expectCompatible());
 }
+
+namespace {
+
+// Interface tables of classes implementing every other interface with ids in [1, 2 * size], with `seed` in vtable
+// to tell the tables apart.
+KStdVector<InterfaceTableRecord> MakeInterfaceTable(int size, int seed) {
+    KStdVector<InterfaceTableRecord> table;
+    for (int i = 0; i < size; ++i) {
+        table.push_back(InterfaceTableRecord{2 * i + 1, static_cast<uint32_t>(seed), nullptr});
+    }
+    return table;
+}
+
+} // namespace
+
+TEST(TypeInfoTest, LookupInterfaceTableRecord) {
+    for (int size : {1, 8, 9, 100}) {
+        // Enough tables for cache slots to collide.
+        KStdVector<KStdVector<InterfaceTableRecord>> tables;
+        for (int seed = 0; seed < 100; ++seed) {
+            tables.push_back(MakeInterfaceTable(size, seed));
+        }
+        // Twice, to hit cached records too.
+        for (int round = 0; round < 2; ++round) {
+            for (int seed = 0; seed < 100; ++seed) {
+                const auto& table = tables[seed];
+                for (int id = 1; id <= 2 * size; ++id) {
+                    auto* record = LookupInterfaceTableRecord(table.data(), size, id);
+                    ASSERT_GE(record, table.data());
+                    ASSERT_LT(record, table.data() + size);
+                    if (id % 2 == 1) {
+                        EXPECT_THAT(record->id, id);
+                        EXPECT_THAT(record->vtableSize, static_cast<uint32_t>(seed));
+                    } else {
+                        EXPECT_THAT(record->id, testing::Ne(id));
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(TypeInfoTest, LookupOpenMethod) {
+    constexpr int kMethodCount = 50;
+    constexpr int kTypeCount = 100;
+    KStdVector<KStdVector<MethodTableRecord>> methods(kTypeCount);
+    KStdVector<TypeInfo> types(kTypeCount);
+    for (int type = 0; type < kTypeCount; ++type) {
+        for (int method = 0; method < kMethodCount; ++method) {
+            void* entryPoint = reinterpret_cast<void*>(static_cast<uintptr_t>(type * kMethodCount + method + 1));
+            methods[type].push_back(MethodTableRecord{method * 1000003LL, entryPoint});
+        }
+        types[type].openMethods_ = methods[type].data();
+        types[type].openMethodsCount_ = kMethodCount;
+    }
+    for (int round = 0; round < 2; ++round) {
+        for (int type = 0; type < kTypeCount; ++type) {
+            for (int method = 0; method < kMethodCount; ++method) {
+                void* expected = reinterpret_cast<void*>(static_cast<uintptr_t>(type * kMethodCount + method + 1));
+                EXPECT_THAT(LookupOpenMethod(&types[type], method * 1000003LL), expected);
+            }
+        }
+    }
+}
@@ -70,6 +70,7 @@ enum JobKind {
   // processed for APIs returning request process status.
   JOB_REGULAR = 2,
   JOB_EXECUTE_AFTER = 3,
+  JOB_EXECUTE_NATIVE = 4,
 };
 
 enum class WorkerKind {
@@ -96,6 +97,11 @@ struct Job {
       KNativePtr operation;
       uint64_t whenExecute;
     } executeAfter;
+
+    struct {
+      void (*function)(void*);
+      void* argument;
+    } executeNative;
   };
 };
 
@@ -138,6 +144,9 @@ class Worker {
 
   JobKind processQueueElement(bool blocking);
 
+  // Runs and disposes the operation of a `JOB_EXECUTE_AFTER` job.
+  void runScheduled(KNativePtr operation);
+
   bool park(KLong timeoutMicroseconds, bool process);
 
   KInt id() const { return id_; }
@@ -376,6 +385,24 @@ class State {
       return true;
   }
 
+  bool scheduleNativeJobInWorkerUnlocked(KInt id, void (*function)(void*), void* argument) {
+      Worker* worker = nullptr;
+      Locker locker(&lock_);
+
+      auto it = workers_.find(id);
+      if (it == workers_.end()) {
+          return false;
+      }
+      worker = it->second;
+
+      Job job;
+      job.kind = JOB_EXECUTE_NATIVE;
+      job.executeNative.function = function;
+      job.executeNative.argument = argument;
+      worker->putJob(job, false);
+      return true;
+  }
+
   // Returns `true` if something was indeed processed.
   bool processQueueUnlocked(KInt id) {
     // Can only process queue of the current worker.
@@ -763,6 +790,23 @@ bool WorkerSchedule(KInt id, KNativePtr jobStablePtr) {
 #endif // WITH_WORKERS
 }
 
+bool WorkerScheduleNative(KInt id, void (*function)(void*), void* argument) {
+#if WITH_WORKERS
+    return theState()->scheduleNativeJobInWorkerUnlocked(id, function, argument);
+#else
+    return false;
+#endif // WITH_WORKERS
+}
+
+void WorkerRunScheduled(KNativePtr jobStablePtr) {
+#if WITH_WORKERS
+    RuntimeAssert(::g_worker != nullptr, "Must be called on a worker");
+    ::g_worker->runScheduled(jobStablePtr);
+#else
+    RuntimeCheck(false, "Workers are not supported");
+#endif // WITH_WORKERS
+}
+
 #if WITH_WORKERS
 
 Worker::~Worker() {
@@ -778,6 +822,10 @@ Worker::~Worker() {
         DisposeStablePointer(job.executeAfter.operation);
         break;
       }
+      case JOB_EXECUTE_NATIVE: {
+        // The argument is owned by whoever scheduled the job.
+        break;
+      }
       case JOB_TERMINATE: {
         // TODO: any more processing here?
         job.terminationRequest.future->cancelUnlocked();
@@ -926,6 +974,21 @@ bool Worker::park(KLong timeoutMicroseconds, bool process) {
   return processQueueElement(false) >= JOB_REGULAR;
 }
 
+void Worker::runScheduled(KNativePtr operation) {
+  ObjHolder operationHolder, dummyHolder;
+  KRef obj = DerefStablePointer(operation, operationHolder.slot());
+  try {
+#if KONAN_OBJC_INTEROP
+    konan::AutoreleasePool autoreleasePool;
+#endif
+    WorkerLaunchpad(obj, dummyHolder.slot());
+  } catch (ExceptionObjHolder& e) {
+    if (errorReporting())
+      ReportUnhandledException(e.GetExceptionObject());
+  }
+  DisposeStablePointer(operation);
+}
+
 JobKind Worker::processQueueElement(bool blocking) {
   GC_CollectorCallback(this);
   ObjHolder argumentHolder;
@@ -950,18 +1013,11 @@ JobKind Worker::processQueueElement(bool blocking) {
       break;
     }
     case JOB_EXECUTE_AFTER: {
-      ObjHolder operationHolder, dummyHolder;
-      KRef obj = DerefStablePointer(job.executeAfter.operation, operationHolder.slot());
-      try {
-#if KONAN_OBJC_INTEROP
-        konan::AutoreleasePool autoreleasePool;
-#endif
-        WorkerLaunchpad(obj, dummyHolder.slot());
-      } catch (ExceptionObjHolder& e) {
-        if (errorReporting())
-          ReportUnhandledException(e.GetExceptionObject());
-      }
-      DisposeStablePointer(job.executeAfter.operation);
+      runScheduled(job.executeAfter.operation);
+      break;
+    }
+    case JOB_EXECUTE_NATIVE: {
+      job.executeNative.function(job.executeNative.argument);
       break;
     }
     case JOB_REGULAR: {
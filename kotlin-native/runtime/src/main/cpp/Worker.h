@@ -18,5 +18,10 @@ void WaitNativeWorkersTermination();
 void WaitNativeWorkerTermination(KInt id);
 // Schedule the job without the result.
 bool WorkerSchedule(KInt id, KNativePtr jobStablePtr);
+// Schedule `function(argument)` to be called on the worker without the result. If the worker terminates before
+// executing the job, the function is not called.
+bool WorkerScheduleNative(KInt id, void (*function)(void*), void* argument);
+// Run and dispose the job the way `WorkerSchedule` does. Must be called on a worker.
+void WorkerRunScheduled(KNativePtr jobStablePtr);
 
 #endif // RUNTIME_WORKER_H
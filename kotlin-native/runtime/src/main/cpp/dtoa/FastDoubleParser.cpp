@@ -0,0 +1,179 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "FastDoubleParser.h"
+
+#include <cfloat>
+#include <cstring>
+#include <limits>
+
+#include "FastDoubleParserTables.h"
+#include "UInt128.h"
+
+using namespace kotlin;
+using namespace kotlin::dtoa;
+
+namespace {
+
+constexpr int kMantissaBits = 52;
+constexpr int kMinExponent = -1023;
+constexpr int kInfinityExponent = 0x7ff;
+
+// Powers of ten that are exactly representable as doubles.
+constexpr int kMaxExactPowerOfTen = 22;
+constexpr double kExactPowersOfTen[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+// Exponents outside of this range can never make a value exact enough to be a tie between two doubles.
+constexpr int kMinRoundToEvenExponent = -4;
+constexpr int kMaxRoundToEvenExponent = 23;
+
+// Keeps exponents of absurdly long inputs from overflowing, anything beyond is zero or infinity anyway.
+constexpr int64_t kMaxExponentMagnitude = 100000;
+
+inline double assemble(uint64_t mantissa, int32_t exponent, bool negative) {
+    uint64_t bits = mantissa | (static_cast<uint64_t>(exponent) << kMantissaBits) | (static_cast<uint64_t>(negative) << 63);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// floor(log2(10^q)) + 63.
+inline int32_t power(int32_t q) {
+    return (((152170 + 65536) * q) >> 16) + 63;
+}
+
+inline int leadingZeros(uint64_t value) {
+    return __builtin_clzll(value);
+}
+
+inline bool isDigit(KChar c) {
+    return c >= '0' && c <= '9';
+}
+
+} // namespace
+
+double kotlin::dtoa::DecimalToDouble(uint64_t digits, int64_t exponent, bool negative) noexcept {
+    // Clinger: both the digits and the power of ten are exact doubles, so is their correctly rounded product.
+    // x87 arithmetic rounds twice, so does not qualify.
+    if (FLT_EVAL_METHOD == 0 && -kMaxExactPowerOfTen <= exponent && exponent <= kMaxExactPowerOfTen &&
+        digits <= (uint64_t(1) << (kMantissaBits + 1))) {
+        double value = static_cast<double>(digits);
+        value = exponent < 0 ? value / kExactPowersOfTen[-exponent] : value * kExactPowersOfTen[exponent];
+        return negative ? -value : value;
+    }
+
+    if (digits == 0 || exponent < kPow5ApproximationMin) return assemble(0, 0, negative);
+    if (exponent > kPow5ApproximationMax) return assemble(0, kInfinityExponent, negative);
+    int32_t q = static_cast<int32_t>(exponent);
+
+    // Eisel-Lemire: multiply the normalized digits by the truncated 128-bit 5^q. The high 64 bits of the product
+    // have enough precision for the rounding decision unless the bits below the mantissa are all ones, then the
+    // lower half of 5^q settles it. No more precision is ever needed for 19-digit input, see "Fast Number Parsing
+    // Without Fallback" by Noble Mushtak and Daniel Lemire.
+    int shift = leadingZeros(digits);
+    uint64_t w = digits << shift;
+    const uint64_t* pow5 = kPow5Approximation[q - kPow5ApproximationMin];
+    UInt128 product = Multiply(w, pow5[1]);
+    constexpr uint64_t kPrecisionMask = std::numeric_limits<uint64_t>::max() >> (kMantissaBits + 3);
+    if ((product.high & kPrecisionMask) == kPrecisionMask) {
+        UInt128 lowProduct = Multiply(w, pow5[0]);
+        product.low += lowProduct.high;
+        if (lowProduct.high > product.low) ++product.high;
+    }
+
+    int upperBit = static_cast<int>(product.high >> 63);
+    // One bit more than the mantissa, to round.
+    uint64_t mantissa = product.high >> (upperBit + 64 - kMantissaBits - 3);
+    int32_t exponent2 = power(q) + upperBit - shift - kMinExponent;
+
+    if (exponent2 <= 0) {
+        // Subnormal.
+        if (-exponent2 + 1 >= 64) return assemble(0, 0, negative);
+        mantissa >>= -exponent2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        // Rounding up may have made it the smallest normal number.
+        exponent2 = mantissa < (uint64_t(1) << kMantissaBits) ? 0 : 1;
+        return assemble(mantissa & ~(uint64_t(1) << kMantissaBits), exponent2, negative);
+    }
+
+    // An exact tie between two doubles rounds to even, rather than up.
+    if (product.low <= 1 && q >= kMinRoundToEvenExponent && q <= kMaxRoundToEvenExponent && (mantissa & 3) == 1 &&
+        (mantissa << (upperBit + 64 - kMantissaBits - 3)) == product.high) {
+        mantissa &= ~uint64_t(1);
+    }
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (uint64_t(2) << kMantissaBits)) {
+        mantissa = uint64_t(1) << kMantissaBits;
+        ++exponent2;
+    }
+    mantissa &= ~(uint64_t(1) << kMantissaBits);
+    if (exponent2 >= kInfinityExponent) return assemble(0, kInfinityExponent, negative);
+    return assemble(mantissa, exponent2, negative);
+}
+
+bool kotlin::dtoa::TryParseDouble(const KChar* chars, size_t length, double* result) noexcept {
+    const KChar* current = chars;
+    const KChar* end = chars + length;
+    while (current < end && *current <= ' ') ++current;
+    while (current < end && end[-1] <= ' ') --end;
+    if (current < end) {
+        KChar suffix = end[-1];
+        if (suffix == 'd' || suffix == 'D' || suffix == 'f' || suffix == 'F') --end;
+    }
+
+    bool negative = false;
+    if (current < end && (*current == '-' || *current == '+')) {
+        negative = *current == '-';
+        ++current;
+    }
+
+    uint64_t digits = 0;
+    int significantDigits = 0;
+    int64_t exponent = 0;
+    bool anyDigits = false;
+    for (; current < end && isDigit(*current); ++current) {
+        anyDigits = true;
+        if (digits == 0 && *current == '0') continue;
+        if (++significantDigits > kMaxFastDigits) return false;
+        digits = digits * 10 + (*current - '0');
+    }
+    if (current < end && *current == '.') {
+        ++current;
+        for (; current < end && isDigit(*current); ++current) {
+            anyDigits = true;
+            --exponent;
+            if (digits == 0 && *current == '0') continue;
+            if (++significantDigits > kMaxFastDigits) return false;
+            digits = digits * 10 + (*current - '0');
+        }
+    }
+    if (!anyDigits) return false;
+
+    if (current < end && (*current == 'e' || *current == 'E')) {
+        ++current;
+        bool negativeExponent = false;
+        if (current < end && (*current == '-' || *current == '+')) {
+            negativeExponent = *current == '-';
+            ++current;
+        }
+        if (current == end || !isDigit(*current)) return false;
+        int64_t explicitExponent = 0;
+        for (; current < end && isDigit(*current); ++current) {
+            if (explicitExponent < kMaxExponentMagnitude) {
+                explicitExponent = explicitExponent * 10 + (*current - '0');
+            }
+        }
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+    if (current != end) return false;
+
+    *result = DecimalToDouble(digits, exponent, negative);
+    return true;
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_DTOA_FAST_DOUBLE_PARSER_H
+#define RUNTIME_DTOA_FAST_DOUBLE_PARSER_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../Types.h"
+
+namespace kotlin {
+namespace dtoa {
+
+// Up to this many decimal digits always fit into uint64_t.
+constexpr int kMaxFastDigits = 19;
+
+// Computes the double closest to `digits * 10^exponent`, with ties rounded to even. Uses Clinger's exact fast path
+// when both parts fit into a double, and the Eisel-Lemire algorithm otherwise. Exact for any `digits`,
+// which must not be a truncated longer decimal.
+double DecimalToDouble(uint64_t digits, int64_t exponent, bool negative) noexcept;
+
+// Parses the whole of `chars` as `Double.parseDouble` does, if it is a plain decimal with at most kMaxFastDigits
+// significant digits: `[+-]digits[.digits][(e|E)[+-]digits][d|D|f|F]`, surrounded by whitespace.
+// Returns false without touching `result` otherwise, such input must go through the general parser.
+bool TryParseDouble(const KChar* chars, size_t length, double* result) noexcept;
+
+} // namespace dtoa
+} // namespace kotlin
+
+#endif // RUNTIME_DTOA_FAST_DOUBLE_PARSER_H
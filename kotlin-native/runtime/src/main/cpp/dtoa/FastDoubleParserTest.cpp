@@ -0,0 +1,136 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "FastDoubleParser.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace kotlin;
+using namespace kotlin::dtoa;
+
+namespace {
+
+bool TryParse(const std::string& string, double* result) {
+    std::basic_string<KChar> chars(string.begin(), string.end());
+    return TryParseDouble(chars.data(), chars.size(), result);
+}
+
+uint64_t Bits(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// Parsed doubles must be bit-for-bit the correctly rounded ones.
+void CheckParse(const std::string& string) {
+    double result;
+    ASSERT_TRUE(TryParse(string, &result)) << string;
+    ASSERT_EQ(Bits(std::strtod(string.c_str(), nullptr)), Bits(result)) << string;
+}
+
+void CheckRejected(const std::string& string) {
+    double result = 42;
+    EXPECT_FALSE(TryParse(string, &result)) << string;
+    EXPECT_EQ(42, result);
+}
+
+} // namespace
+
+TEST(FastDoubleParserTest, Syntax) {
+    double result;
+    ASSERT_TRUE(TryParse("  -1.5e3d\n", &result));
+    EXPECT_EQ(-1500.0, result);
+    ASSERT_TRUE(TryParse("+.5", &result));
+    EXPECT_EQ(0.5, result);
+    ASSERT_TRUE(TryParse("2.", &result));
+    EXPECT_EQ(2.0, result);
+    ASSERT_TRUE(TryParse("1E+2F", &result));
+    EXPECT_EQ(100.0, result);
+    ASSERT_TRUE(TryParse("-0.0", &result));
+    EXPECT_EQ(Bits(-0.0), Bits(result));
+    ASSERT_TRUE(TryParse("00000000000000000000000000.1", &result));
+    EXPECT_EQ(0.1, result);
+}
+
+TEST(FastDoubleParserTest, Rejected) {
+    CheckRejected("");
+    CheckRejected(" ");
+    CheckRejected(".");
+    CheckRejected("-");
+    CheckRejected("e5");
+    CheckRejected("1e");
+    CheckRejected("1e+");
+    CheckRejected("1e++5");
+    CheckRejected("1dd");
+    CheckRejected("1 2");
+    CheckRejected("NaN");
+    CheckRejected("Infinity");
+    CheckRejected("0x1p3");
+    CheckRejected("1.2.3");
+    // Too many digits for uint64_t.
+    CheckRejected("12345678901234567890");
+    CheckRejected("0.12345678901234567890");
+}
+
+TEST(FastDoubleParserTest, Values) {
+    CheckParse("0");
+    CheckParse("3.14");
+    CheckParse("1234567890123456789");
+    CheckParse("9007199254740993");
+    CheckParse("9007199254740995");
+    CheckParse("0.1e-22");
+    CheckParse("1e23");
+    CheckParse("8.41e21");
+    CheckParse("4.9e-324");
+    CheckParse("2.4703282292062327e-324");
+    CheckParse("2.4703282292062328e-324");
+    CheckParse("2.2250738585072011e-308");
+    CheckParse("2.2250738585072014e-308");
+    CheckParse("1.7976931348623157e308");
+    CheckParse("1.7976931348623158e308");
+    CheckParse("1.7976931348623159e308");
+    CheckParse("1e-400");
+    CheckParse("1e400");
+    CheckParse("1e99999999999999999999");
+    CheckParse("1e-99999999999999999999");
+}
+
+TEST(FastDoubleParserTest, RandomValues) {
+    std::mt19937_64 random(42);
+    char buffer[64];
+    for (int i = 0; i < 1000000; ++i) {
+        uint64_t bits = random();
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value)) continue;
+        // Shortest, truncated and padded representations.
+        snprintf(buffer, sizeof(buffer), "%.17g", value);
+        CheckParse(buffer);
+        snprintf(buffer, sizeof(buffer), "%.*e", static_cast<int>(random() % 19), value);
+        CheckParse(buffer);
+    }
+    for (int i = 0; i < 1000000; ++i) {
+        snprintf(buffer, sizeof(buffer), "%llu.%llue%d", static_cast<unsigned long long>(random() % 1000000000),
+                 static_cast<unsigned long long>(random() % 1000000000), static_cast<int>(random() % 700) - 350);
+        CheckParse(buffer);
+    }
+}
+
+TEST(FastDoubleParserTest, DecimalToDouble) {
+    EXPECT_EQ(Bits(1e300), Bits(DecimalToDouble(1, 300, false)));
+    EXPECT_EQ(Bits(-5e-324), Bits(DecimalToDouble(5, -324, true)));
+    EXPECT_EQ(Bits(-0.0), Bits(DecimalToDouble(0, 5, true)));
+    EXPECT_EQ(Bits(std::numeric_limits<double>::infinity()), Bits(DecimalToDouble(1, 309, false)));
+    EXPECT_EQ(Bits(std::numeric_limits<double>::max()), Bits(DecimalToDouble(17976931348623157, 292, false)));
+    EXPECT_EQ(Bits(std::numeric_limits<double>::min()), Bits(DecimalToDouble(22250738585072014, -324, false)));
+}
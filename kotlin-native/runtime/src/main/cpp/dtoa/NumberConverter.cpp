@@ -0,0 +1,201 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "NumberConverter.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "ShortestDecimal.h"
+#include "../KString.h"
+#include "../Memory.h"
+#include "../Natives.h"
+#include "../Types.h"
+
+using namespace kotlin;
+using namespace kotlin::dtoa;
+
+namespace {
+
+// The digits used to be generated by Burger-Dybvig algorithm in two flavours: with 64-bit arithmetic for exponents
+// close to zero, and with big integers otherwise. They differ in the width of the rounding interval around powers
+// of two and in whether the interval bounds are included, so the intervals below replicate their output exactly.
+struct Interval {
+    int lowerQuarters;
+    int upperQuarters;
+    bool inclusive;
+};
+
+// 64-bit generator: strict bounds, and the narrower interval below powers of two is used above them too.
+constexpr Interval kLongInterval = { 2, 2, false };
+constexpr Interval kLongPowerOfTwoInterval = { 1, 1, false };
+
+// Big integer generator: inclusive bounds. Doubles never got the narrower interval below powers of two,
+// because the check overflowed a 32-bit shift.
+constexpr Interval kBigIntInterval = { 2, 2, true };
+constexpr Interval kBigIntFloatPowerOfTwoInterval = { 1, 2, true };
+
+size_t writeInt(char* buffer, int32_t value) {
+    char* out = buffer;
+    uint32_t magnitude = value;
+    if (value < 0) {
+        *out++ = '-';
+        magnitude = -magnitude;
+    }
+    char digits[10];
+    size_t count = 0;
+    do {
+        digits[count++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0);
+    while (count > 0) *out++ = digits[--count];
+    return out - buffer;
+}
+
+// Formats like Java: "1.25E-5" for the exponential notation, "12500.0" or "0.0125" otherwise.
+size_t writeDecimal(char* buffer, bool negative, Decimal decimal, bool exponential) {
+    while (decimal.digits % 10 == 0 && decimal.digits != 0) {
+        decimal.digits /= 10;
+        ++decimal.exponent;
+    }
+    char digits[20];
+    int32_t count = 0;
+    for (uint64_t rest = decimal.digits; rest != 0; rest /= 10) {
+        digits[count++] = '0' + rest % 10;
+    }
+    for (int32_t i = 0, j = count - 1; i < j; ++i, --j) {
+        char digit = digits[i];
+        digits[i] = digits[j];
+        digits[j] = digit;
+    }
+    // Power of ten of the first digit.
+    int32_t firstExponent = decimal.exponent + count - 1;
+
+    char* out = buffer;
+    if (negative) *out++ = '-';
+    if (exponential) {
+        *out++ = digits[0];
+        *out++ = '.';
+        if (count == 1) {
+            *out++ = '0';
+        } else {
+            memcpy(out, digits + 1, count - 1);
+            out += count - 1;
+        }
+        *out++ = 'E';
+        out += writeInt(out, firstExponent);
+        return out - buffer;
+    }
+    int32_t exponent = firstExponent;
+    if (exponent < 0) {
+        *out++ = '0';
+        *out++ = '.';
+        for (int32_t i = exponent + 1; i < 0; ++i) *out++ = '0';
+    }
+    int32_t index = 0;
+    do {
+        if (index < count) {
+            *out++ = digits[index];
+        } else if (exponent >= -1) {
+            *out++ = '0';
+        }
+        if (exponent == 0) *out++ = '.';
+        --exponent;
+        ++index;
+    } while (index < count || exponent >= -1);
+    return out - buffer;
+}
+
+size_t writeSpecial(char* buffer, bool negative, const char* value) {
+    char* out = buffer;
+    if (negative) *out++ = '-';
+    size_t length = strlen(value);
+    memcpy(out, value, length);
+    return out - buffer + length;
+}
+
+OBJ_GETTER(createString, const char* buffer, size_t length) {
+    ArrayHeader* result = AllocArrayInstance(theStringTypeInfo, length, OBJ_RESULT)->array();
+    KChar* chars = CharArrayAddressOfElementAt(result, 0);
+    for (size_t i = 0; i < length; ++i) {
+        chars[i] = buffer[i];
+    }
+    RETURN_OBJ(result->obj());
+}
+
+} // namespace
+
+size_t kotlin::dtoa::FormatDouble(double value, char* buffer) noexcept {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    bool negative = (bits >> 63) != 0;
+    int32_t exponentBits = (bits >> 52) & 0x7ff;
+    uint64_t mantissa = bits & ((uint64_t(1) << 52) - 1);
+
+    if (exponentBits == 0x7ff) {
+        return mantissa == 0 ? writeSpecial(buffer, negative, "Infinity") : writeSpecial(buffer, false, "NaN");
+    }
+    if (exponentBits == 0 && mantissa == 0) return writeSpecial(buffer, negative, "0.0");
+    // Has always been printed with more digits than needed.
+    if (exponentBits == 0 && mantissa == 1) return writeSpecial(buffer, negative, "4.9E-324");
+
+    uint64_t m2 = exponentBits == 0 ? mantissa : mantissa | (uint64_t(1) << 52);
+    int32_t e2 = (exponentBits == 0 ? 1 : exponentBits) - 1075;
+    bool powerOfTwo = mantissa == 0;
+    Interval interval = kBigIntInterval;
+    if ((-59 < e2 && e2 < 6) || (e2 == -59 && !powerOfTwo)) {
+        interval = powerOfTwo ? kLongPowerOfTwoInterval : kLongInterval;
+    }
+    Decimal decimal = ShortestDecimal(m2, e2, interval.lowerQuarters, interval.upperQuarters, interval.inclusive);
+    double magnitude = std::fabs(value);
+    return writeDecimal(buffer, negative, decimal, magnitude >= 1e7 || magnitude < 1e-3);
+}
+
+size_t kotlin::dtoa::FormatFloat(float value, char* buffer) noexcept {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    bool negative = (bits >> 31) != 0;
+    int32_t exponentBits = (bits >> 23) & 0xff;
+    uint32_t mantissa = bits & ((uint32_t(1) << 23) - 1);
+
+    if (exponentBits == 0xff) {
+        return mantissa == 0 ? writeSpecial(buffer, negative, "Infinity") : writeSpecial(buffer, false, "NaN");
+    }
+    if (exponentBits == 0 && mantissa == 0) return writeSpecial(buffer, negative, "0.0");
+
+    uint64_t m2 = exponentBits == 0 ? mantissa : mantissa | (uint32_t(1) << 23);
+    int32_t e2 = (exponentBits == 0 ? 1 : exponentBits) - 150;
+    bool powerOfTwo = exponentBits != 0 && mantissa == 0;
+    if (exponentBits == 0 && mantissa < 8) {
+        // The smallest denormals have always been printed with more digits than needed:
+        // their interval was 4 times narrower.
+        m2 <<= 2;
+        e2 -= 2;
+    }
+    Interval interval = powerOfTwo ? kBigIntFloatPowerOfTwoInterval : kBigIntInterval;
+    if ((-59 < e2 && e2 < 35) || (e2 == -59 && mantissa != 0)) {
+        interval = powerOfTwo ? kLongPowerOfTwoInterval : kLongInterval;
+    }
+    Decimal decimal = ShortestDecimal(m2, e2, interval.lowerQuarters, interval.upperQuarters, interval.inclusive);
+    float magnitude = std::fabs(value);
+    return writeDecimal(buffer, negative, decimal, magnitude >= 1e7f || magnitude < 1e-3f);
+}
+
+extern "C" {
+
+OBJ_GETTER(Kotlin_native_NumberConverter_convertDouble, KDouble value) {
+    char buffer[kMaxFormattedLength];
+    size_t length = FormatDouble(value, buffer);
+    RETURN_RESULT_OF(createString, buffer, length);
+}
+
+OBJ_GETTER(Kotlin_native_NumberConverter_convertFloat, KFloat value) {
+    char buffer[kMaxFormattedLength];
+    size_t length = FormatFloat(value, buffer);
+    RETURN_RESULT_OF(createString, buffer, length);
+}
+
+} // extern "C"
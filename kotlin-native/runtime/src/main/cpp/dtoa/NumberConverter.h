@@ -0,0 +1,25 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_DTOA_NUMBER_CONVERTER_H
+#define RUNTIME_DTOA_NUMBER_CONVERTER_H
+
+#include <cstddef>
+
+namespace kotlin {
+namespace dtoa {
+
+// Enough for "-2.2250738585072014E-308".
+constexpr size_t kMaxFormattedLength = 32;
+
+// Write `Double.toString()` and `Float.toString()` of `value` into `buffer` of kMaxFormattedLength chars,
+// without a terminating zero. Return the number of chars written.
+size_t FormatDouble(double value, char* buffer) noexcept;
+size_t FormatFloat(float value, char* buffer) noexcept;
+
+} // namespace dtoa
+} // namespace kotlin
+
+#endif // RUNTIME_DTOA_NUMBER_CONVERTER_H
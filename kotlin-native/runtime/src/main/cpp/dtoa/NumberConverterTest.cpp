@@ -0,0 +1,156 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "NumberConverter.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace kotlin;
+using namespace kotlin::dtoa;
+
+namespace {
+
+std::string Format(double value) {
+    char buffer[kMaxFormattedLength];
+    return std::string(buffer, FormatDouble(value, buffer));
+}
+
+std::string Format(float value) {
+    char buffer[kMaxFormattedLength];
+    return std::string(buffer, FormatFloat(value, buffer));
+}
+
+template <typename T, typename Bits>
+T FromBits(Bits bits) {
+    static_assert(sizeof(T) == sizeof(Bits), "Bits must have the size of the value");
+    T value;
+    memcpy(&value, &bits, sizeof(T));
+    return value;
+}
+
+// Formatted values must parse back into the same bits.
+void CheckRoundTrip(float value) {
+    std::string formatted = Format(value);
+    float parsed = std::strtof(formatted.c_str(), nullptr);
+    ASSERT_EQ(0, memcmp(&value, &parsed, sizeof(float))) << formatted;
+}
+
+// Doubles far from 1 include the interval bounds, so a decimal exactly halfway to the neighbour may be chosen,
+// and then parsing rounds to even. Kept for compatibility.
+void CheckRoundTripToNeighbour(double value) {
+    std::string formatted = Format(value);
+    double parsed = std::strtod(formatted.c_str(), nullptr);
+    ASSERT_TRUE(parsed == value || std::nextafter(value, parsed) == parsed) << formatted;
+}
+
+} // namespace
+
+TEST(NumberConverterTest, SpecialDoubles) {
+    EXPECT_THAT(Format(0.0), "0.0");
+    EXPECT_THAT(Format(-0.0), "-0.0");
+    EXPECT_THAT(Format(std::numeric_limits<double>::infinity()), "Infinity");
+    EXPECT_THAT(Format(-std::numeric_limits<double>::infinity()), "-Infinity");
+    EXPECT_THAT(Format(std::numeric_limits<double>::quiet_NaN()), "NaN");
+    EXPECT_THAT(Format(-std::numeric_limits<double>::quiet_NaN()), "NaN");
+    EXPECT_THAT(Format(std::numeric_limits<double>::denorm_min()), "4.9E-324");
+    EXPECT_THAT(Format(-std::numeric_limits<double>::denorm_min()), "-4.9E-324");
+}
+
+TEST(NumberConverterTest, SpecialFloats) {
+    EXPECT_THAT(Format(0.0f), "0.0");
+    EXPECT_THAT(Format(-0.0f), "-0.0");
+    EXPECT_THAT(Format(std::numeric_limits<float>::infinity()), "Infinity");
+    EXPECT_THAT(Format(-std::numeric_limits<float>::infinity()), "-Infinity");
+    EXPECT_THAT(Format(std::numeric_limits<float>::quiet_NaN()), "NaN");
+    EXPECT_THAT(Format(-std::numeric_limits<float>::quiet_NaN()), "NaN");
+}
+
+// Expected strings are what the Burger-Dybvig based implementation produced.
+TEST(NumberConverterTest, Doubles) {
+    EXPECT_THAT(Format(1.0), "1.0");
+    EXPECT_THAT(Format(-1.0), "-1.0");
+    EXPECT_THAT(Format(0.1), "0.1");
+    EXPECT_THAT(Format(0.3), "0.3");
+    EXPECT_THAT(Format(0.01), "0.01");
+    EXPECT_THAT(Format(0.5), "0.5");
+    EXPECT_THAT(Format(100.0), "100.0");
+    EXPECT_THAT(Format(1024.0), "1024.0");
+    EXPECT_THAT(Format(4.35), "4.35");
+    EXPECT_THAT(Format(1234.5678), "1234.5678");
+    EXPECT_THAT(Format(1.0 / 3), "0.3333333333333333");
+    EXPECT_THAT(Format(2.0 / 3), "0.6666666666666666");
+    EXPECT_THAT(Format(9999999.0), "9999999.0");
+    EXPECT_THAT(Format(1e7), "1.0E7");
+    EXPECT_THAT(Format(0.001), "0.001");
+    EXPECT_THAT(Format(9.99e-4), "9.99E-4");
+    EXPECT_THAT(Format(1e21), "1.0E21");
+    EXPECT_THAT(Format(1e22), "1.0E22");
+    EXPECT_THAT(Format(1e23), "1.0E23");
+    EXPECT_THAT(Format(0x1.b69b4ba630f35p+56), "1.2345678901234568E17");
+    EXPECT_THAT(Format(0x1.ae7a25fe706ecp+355), "1.2341234124312331E107");
+    EXPECT_THAT(Format(0x1p-20), "9.5367431640625E-7");
+    EXPECT_THAT(Format(0x1p+53), "9.007199254740992E15");
+    EXPECT_THAT(Format(0x1p+58), "2.8823037615171174E17");
+    EXPECT_THAT(Format(0x1p+60), "1.152921504606847E18");
+    EXPECT_THAT(Format(std::numeric_limits<double>::max()), "1.7976931348623157E308");
+    EXPECT_THAT(Format(std::numeric_limits<double>::min()), "2.2250738585072014E-308");
+    EXPECT_THAT(Format(0x0.fffffffffffffp-1022), "2.225073858507201E-308");
+    EXPECT_THAT(Format(2 * std::numeric_limits<double>::denorm_min()), "1.0E-323");
+}
+
+TEST(NumberConverterTest, Floats) {
+    EXPECT_THAT(Format(1.0f), "1.0");
+    EXPECT_THAT(Format(2.0f), "2.0");
+    EXPECT_THAT(Format(0.25f), "0.25");
+    EXPECT_THAT(Format(0.1f), "0.1");
+    EXPECT_THAT(Format(0.3f), "0.3");
+    EXPECT_THAT(Format(1.0f / 3), "0.33333334");
+    EXPECT_THAT(Format(9999999.0f), "9999999.0");
+    EXPECT_THAT(Format(1e7f), "1.0E7");
+    EXPECT_THAT(Format(0.001f), "0.001");
+    EXPECT_THAT(Format(5.0e-10f), "5.0E-10");
+    EXPECT_THAT(Format(1e10f), "1.0E10");
+    EXPECT_THAT(Format(0x1.00004cp+33f), "8.589974E9");
+    EXPECT_THAT(Format(0x1.5c87fap-84f), "7.038531E-26");
+    EXPECT_THAT(Format(0x1p+24f), "1.6777216E7");
+    EXPECT_THAT(Format(0x1p+25f), "3.3554432E7");
+    EXPECT_THAT(Format(0x1p+26f), "6.7108864E7");
+    EXPECT_THAT(Format(std::numeric_limits<float>::max()), "3.4028235E38");
+    EXPECT_THAT(Format(std::numeric_limits<float>::min()), "1.1754944E-38");
+    EXPECT_THAT(Format(0x1.fffffcp-127f), "1.1754942E-38");
+    EXPECT_THAT(Format(std::numeric_limits<float>::denorm_min()), "1.4E-45");
+    EXPECT_THAT(Format(2 * std::numeric_limits<float>::denorm_min()), "2.8E-45");
+}
+
+TEST(NumberConverterTest, RandomDoublesParseBack) {
+    std::mt19937_64 random(42);
+    for (int i = 0; i < 1000000; ++i) {
+        double value = FromBits<double>(random());
+        if (std::isnan(value)) continue;
+        CheckRoundTripToNeighbour(value);
+    }
+}
+
+TEST(NumberConverterTest, SampledFloatsRoundTrip) {
+    for (uint64_t bits = 0; bits < 0x7f800000; bits += 997) {
+        CheckRoundTrip(FromBits<float>(static_cast<uint32_t>(bits)));
+        CheckRoundTrip(FromBits<float>(static_cast<uint32_t>(bits | 0x80000000)));
+    }
+}
+
+// Takes a few minutes.
+TEST(NumberConverterTest, DISABLED_AllFloatsRoundTrip) {
+    for (uint64_t bits = 0; bits < 0x7f800000; ++bits) {
+        CheckRoundTrip(FromBits<float>(static_cast<uint32_t>(bits)));
+    }
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ShortestDecimal.h"
+
+#include "ShortestDecimalTables.h"
+#include "UInt128.h"
+
+using namespace kotlin;
+using namespace kotlin::dtoa;
+
+namespace {
+
+// ceil(log2(5^e)) for 0 < e <= 3528, and 1 for e == 0.
+inline int32_t pow5Bits(int32_t e) {
+    return static_cast<int32_t>((static_cast<uint32_t>(e) * 1217359) >> 19) + 1;
+}
+
+// floor(log10(2^e)) for 0 <= e <= 1650.
+inline uint32_t log10Pow2(int32_t e) {
+    return (static_cast<uint32_t>(e) * 78913) >> 18;
+}
+
+// floor(log10(5^e)) for 0 <= e <= 2620.
+inline uint32_t log10Pow5(int32_t e) {
+    return (static_cast<uint32_t>(e) * 732923) >> 20;
+}
+
+inline bool multipleOfPowerOf5(uint64_t value, uint32_t p) {
+    uint32_t count = 0;
+    while (value % 5 == 0) {
+        value /= 5;
+        if (++count >= p) return true;
+    }
+    return count >= p;
+}
+
+inline bool multipleOfPowerOf2(uint64_t value, uint32_t p) {
+    return (value & ((uint64_t(1) << p) - 1)) == 0;
+}
+
+// (m * mul) >> j, where `mul` is a 128-bit number {low, high} and 64 < j < 128.
+inline uint64_t mulShift64(uint64_t m, const uint64_t* mul, int32_t j) {
+    UInt128 low = Multiply(m, mul[0]);
+    UInt128 high = Multiply(m, mul[1]);
+    uint64_t sum = low.high + high.low;
+    uint64_t highHigh = high.high + (sum < low.high);
+    int32_t shift = j - 64;
+    return (highHigh << (64 - shift)) | (sum >> shift);
+}
+
+} // namespace
+
+Decimal kotlin::dtoa::ShortestDecimal(uint64_t m2, int32_t e2, int lowerQuarters, int upperQuarters, bool inclusive) noexcept {
+    // Work with quarters of the unit in the last place, so that the interval bounds are integers.
+    e2 -= 2;
+    uint64_t mv = 4 * m2;
+    uint64_t mp = mv + upperQuarters;
+    uint64_t mm = mv - lowerQuarters;
+
+    // Scale the value and the bounds by 10^-e10, so that the interval is at least one unit wide,
+    // keeping one more digit than necessary for rounding.
+    uint64_t vr, vp, vm;
+    int32_t e10;
+    bool vmIsExact = false;
+    if (e2 >= 0) {
+        uint32_t q = log10Pow2(e2) - (e2 > 3);
+        e10 = static_cast<int32_t>(q);
+        int32_t k = kPow5InvBitCount + pow5Bits(q) - 1;
+        int32_t j = -e2 + static_cast<int32_t>(q) + k;
+        vr = mulShift64(mv, kPow5InvSplit[q], j);
+        vp = mulShift64(mp, kPow5InvSplit[q], j);
+        vm = mulShift64(mm, kPow5InvSplit[q], j);
+        // The scaled bounds are exact iff they are multiples of 5^q, which is only possible for small q.
+        if (q <= 21) {
+            if (inclusive) {
+                vmIsExact = multipleOfPowerOf5(mm, q);
+            } else {
+                vp -= multipleOfPowerOf5(mp, q);
+            }
+        }
+    } else {
+        uint32_t q = log10Pow5(-e2) - (-e2 > 1);
+        e10 = static_cast<int32_t>(q) + e2;
+        int32_t i = -e2 - static_cast<int32_t>(q);
+        int32_t k = pow5Bits(i) - kPow5BitCount;
+        int32_t j = static_cast<int32_t>(q) - k;
+        vr = mulShift64(mv, kPow5Split[i], j);
+        vp = mulShift64(mp, kPow5Split[i], j);
+        vm = mulShift64(mm, kPow5Split[i], j);
+        // The scaled bounds are exact iff they are multiples of 2^q.
+        if (q < 63) {
+            if (inclusive) {
+                vmIsExact = multipleOfPowerOf2(mm, q);
+            } else {
+                vp -= multipleOfPowerOf2(mp, q);
+            }
+        }
+    }
+
+    // Remove digits while the interval still contains a shorter decimal.
+    int32_t removed = 0;
+    uint64_t output;
+    if (vmIsExact) {
+        uint32_t lastRemovedDigit = 0;
+        while (vp / 10 > vm / 10) {
+            vmIsExact &= vm % 10 == 0;
+            lastRemovedDigit = vr % 10;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+        if (vmIsExact) {
+            // The lower bound itself belongs to the interval, and it may be shorter still.
+            while (vm % 10 == 0) {
+                lastRemovedDigit = vr % 10;
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                ++removed;
+            }
+        }
+        output = vr + ((vr == vm && !vmIsExact) || lastRemovedDigit >= 5);
+    } else {
+        bool roundUp = false;
+        if (vp / 100 > vm / 100) {
+            roundUp = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while (vp / 10 > vm / 10) {
+            roundUp = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+        // The truncated lower bound is outside of the interval.
+        output = vr + (vr == vm || roundUp);
+    }
+    return Decimal{output, e10 + removed};
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_DTOA_SHORTEST_DECIMAL_H
+#define RUNTIME_DTOA_SHORTEST_DECIMAL_H
+
+#include <cstdint>
+
+namespace kotlin {
+namespace dtoa {
+
+// `digits * 10^exponent`.
+struct Decimal {
+    uint64_t digits;
+    int32_t exponent;
+};
+
+// Finds the shortest decimal within the rounding interval of `m2 * 2^e2`, using Ryu by Ulf Adams
+// (https://github.com/ulfjack/ryu). If there are two shortest decimals in the interval, takes the closest one,
+// rounding ties up.
+//
+// The interval spans `lowerQuarters` and `upperQuarters` quarters of 2^e2 below and above the value, `inclusive`
+// tells if its bounds belong to it. Apart from the usual half of a unit in the last place, this allows reproducing
+// the digits of the legacy Burger-Dybvig generators exactly.
+//
+// `m2` must be below 2^54 and `e2` between -1074 and 971, which covers all doubles and floats.
+Decimal ShortestDecimal(uint64_t m2, int32_t e2, int lowerQuarters, int upperQuarters, bool inclusive) noexcept;
+
+} // namespace dtoa
+} // namespace kotlin
+
+#endif // RUNTIME_DTOA_SHORTEST_DECIMAL_H
@@ -0,0 +1,39 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_DTOA_UINT128_H
+#define RUNTIME_DTOA_UINT128_H
+
+#include <cstdint>
+
+namespace kotlin {
+namespace dtoa {
+
+struct UInt128 {
+    uint64_t low;
+    uint64_t high;
+};
+
+// Full 128-bit product of `a` and `b`.
+inline UInt128 Multiply(uint64_t a, uint64_t b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    return UInt128{static_cast<uint64_t>(product), static_cast<uint64_t>(product >> 64)};
+#else
+    // 32-bit targets have no 128-bit integers.
+    uint64_t aLow = static_cast<uint32_t>(a), aHigh = a >> 32;
+    uint64_t bLow = static_cast<uint32_t>(b), bHigh = b >> 32;
+    uint64_t lowLow = aLow * bLow;
+    uint64_t middle1 = aHigh * bLow + (lowLow >> 32);
+    uint64_t middle2 = aLow * bHigh + static_cast<uint32_t>(middle1);
+    uint64_t high = aHigh * bHigh + (middle1 >> 32) + (middle2 >> 32);
+    return UInt128{(middle2 << 32) | static_cast<uint32_t>(lowLow), high};
+#endif
+}
+
+} // namespace dtoa
+} // namespace kotlin
+
+#endif // RUNTIME_DTOA_UINT128_H
@@ -4,16 +4,39 @@
  */
 
 #include "polyhash/PolyHash.h"
+
+#include <atomic>
+
 #include "polyhash/naive.h"
 #include "polyhash/x86.h"
 #include "polyhash/arm.h"
 
-int polyHash(int length, uint16_t const* str) {
+namespace {
+
+PolyHashFunction* polyHashResolve() {
 #if defined(__x86_64__) or defined(__i386__)
-    return polyHash_x86(length, str);
+    return polyHashResolve_x86();
 #elif defined(__arm__) or defined(__aarch64__)
-    return polyHash_arm(length, str);
+    return polyHashResolve_arm();
 #else
-    return polyHash_naive(length, str);
+    return polyHash_naive;
 #endif
-}
\ No newline at end of file
+}
+
+int polyHashFirstCall(int length, uint16_t const* str);
+
+// CPU features are checked only once: the first call replaces itself with the best supported implementation.
+// Racing first calls resolve to the same function, so a relaxed store is enough.
+std::atomic<PolyHashFunction*> polyHashImpl = polyHashFirstCall;
+
+int polyHashFirstCall(int length, uint16_t const* str) {
+    PolyHashFunction* impl = polyHashResolve();
+    polyHashImpl.store(impl, std::memory_order_relaxed);
+    return impl(length, str);
+}
+
+}
+
+int polyHash(int length, uint16_t const* str) {
+    return polyHashImpl.load(std::memory_order_relaxed)(length, str);
+}
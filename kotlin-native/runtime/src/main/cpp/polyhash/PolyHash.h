@@ -8,6 +8,8 @@
 
 #include <stdint.h>
 
+using PolyHashFunction = int(int length, uint16_t const* str);
+
 // Computes polynomial hash with base = 31.
 int polyHash(int length, uint16_t const* str);
 
@@ -5,13 +5,15 @@
 
 #include "polyhash/PolyHash.h"
 #include "polyhash/naive.h"
+#include "polyhash/x86.h"
+#include "polyhash/arm.h"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
 namespace {
 
-TEST(PolyHashTest, Correctness) {
+void checkCorrectness(PolyHashFunction* hash) {
   const int maxLength = 10000;
   uint16_t str[maxLength + 100];
   for (int k = 1; k <= maxLength; ++k) {
@@ -20,8 +22,31 @@ TEST(PolyHashTest, Correctness) {
     str[k] = 0;
 
     for (int shift = 0; shift < 8 && k - shift > 0; ++shift)
-      EXPECT_EQ(polyHash_naive(k - shift, str + shift), polyHash(k - shift, str + shift));
+      EXPECT_EQ(polyHash_naive(k - shift, str + shift), hash(k - shift, str + shift)) << "length " << k - shift;
   }
 }
 
-}
\ No newline at end of file
+TEST(PolyHashTest, Correctness) {
+  checkCorrectness(polyHash);
+}
+
+#if defined(__x86_64__) or defined(__i386__)
+
+TEST(PolyHashTest, CorrectnessSSE41) {
+  if (!__builtin_cpu_supports("sse4.1")) GTEST_SKIP();
+  checkCorrectness(polyHash_x86_sse41);
+}
+
+TEST(PolyHashTest, CorrectnessAVX2) {
+  if (!__builtin_cpu_supports("avx2")) GTEST_SKIP();
+  checkCorrectness(polyHash_x86_avx2);
+}
+
+TEST(PolyHashTest, CorrectnessAVX512) {
+  if (!__builtin_cpu_supports("avx512f")) GTEST_SKIP();
+  checkCorrectness(polyHash_x86_avx512);
+}
+
+#endif
+
+}
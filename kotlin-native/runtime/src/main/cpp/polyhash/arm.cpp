@@ -10,8 +10,8 @@
 
 #ifndef __ARM_NEON
 
-int polyHash_arm(int length, uint16_t const* str) {
-    return polyHash_naive(length, str);
+PolyHashFunction* polyHashResolve_arm() {
+    return polyHash_naive;
 }
 
 #else
@@ -94,11 +94,7 @@ struct NeonTraits {
 
 }
 
-int polyHash_arm(int length, uint16_t const* str) {
-    if (!neonSupported) {
-        // Vectorization is not supported.
-        return polyHash_naive(length, str);
-    }
+int polyHash_arm_neon(int length, uint16_t const* str) {
     uint32_t res;
     if (length < 488)
         res = NeonTraits::polyHashUnalignedUnrollUpTo16(length / 4, str);
@@ -110,6 +106,16 @@ int polyHash_arm(int length, uint16_t const* str) {
     return res;
 }
 
+PolyHashFunction* polyHashResolve_arm() {
+    // Scalable vectors (SVE) can't be plugged into the fixed-width traits from common.h,
+    // an SVE implementation should be selected here the same way, before falling back to Neon.
+    if (!neonSupported) {
+        // Vectorization is not supported.
+        return polyHash_naive;
+    }
+    return polyHash_arm_neon;
+}
+
 #endif // __ARM_NEON
 
 #endif // defined(__arm__) or defined(__aarch64__)
\ No newline at end of file
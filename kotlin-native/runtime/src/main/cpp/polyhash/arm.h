@@ -6,6 +6,12 @@
 #ifndef RUNTIME_POLYHASH_ARM_H
 #define RUNTIME_POLYHASH_ARM_H
 
-int polyHash_arm(int length, uint16_t const* str);
+#include "polyhash/PolyHash.h"
+
+// May only be called if the current CPU supports Neon.
+int polyHash_arm_neon(int length, uint16_t const* str);
+
+// Picks the fastest implementation the current CPU supports.
+PolyHashFunction* polyHashResolve_arm();
 
 #endif  // RUNTIME_POLYHASH_ARM_H
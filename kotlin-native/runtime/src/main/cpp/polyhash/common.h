@@ -7,6 +7,7 @@
 #define RUNTIME_POLYHASH_COMMON_H
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include "polyhash/naive.h"
 #include "../Common.h"
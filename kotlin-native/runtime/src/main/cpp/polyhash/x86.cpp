@@ -10,6 +10,7 @@
 
 #define __SSE41__ __attribute__((target("sse4.1")))
 #define __AVX2__ __attribute__((target("avx2")))
+#define __AVX512__ __attribute__((target("avx512f")))
 
 #include <immintrin.h>
 
@@ -22,6 +23,13 @@ alignas(32) constexpr auto b16 = RepeatingPowers<8>(31, 16); // [base^16, base^1
 alignas(32) constexpr auto b8  = RepeatingPowers<8>(31, 8);  // [base^8,  base^8,  .., base^8 ] (8)
 alignas(32) constexpr auto b4  = RepeatingPowers<8>(31, 4);  // [base^4,  base^4,  .., base^4 ] (8)
 
+// 512-bit loads need both wider and stricter aligned constants.
+alignas(64) constexpr auto p128   = DecreasingPowers<128>(31);   // [base^127, base^126, .., base^2, base, 1]
+alignas(64) constexpr auto b128x16 = RepeatingPowers<16>(31, 128); // [base^128, base^128, .., base^128] (16)
+alignas(64) constexpr auto b64x16  = RepeatingPowers<16>(31, 64);  // [base^64,  base^64,  .., base^64 ] (16)
+alignas(64) constexpr auto b32x16  = RepeatingPowers<16>(31, 32);  // [base^32,  base^32,  .., base^32 ] (16)
+alignas(64) constexpr auto b16x16  = RepeatingPowers<16>(31, 16);  // [base^16,  base^16,  .., base^16 ] (16)
+
 struct SSETraits {
     using VecType = __m128i;
     using Vec128Type = __m128i;
@@ -123,43 +131,132 @@ struct AVX2Traits {
     }
 };
 
+struct AVX512Traits {
+    using VecType = __m512i;
+    using Vec128Type = __m128i;
+    using U16VecType = __m256i;
+
+    __AVX512__ static VecType initVec() { return _mm512_setzero_si512(); }
+    __AVX512__ static Vec128Type initVec128() { return _mm_setzero_si128(); }
+    __AVX512__ static int vec128toInt(Vec128Type x) { return _mm_cvtsi128_si32(x); }
+    __AVX512__ static VecType u16Load(U16VecType x) { return _mm512_cvtepu16_epi32(x); }
+    __AVX512__ static Vec128Type vec128Mul(Vec128Type x, Vec128Type y) { return _mm_mullo_epi32(x, y); }
+    __AVX512__ static Vec128Type vec128Add(Vec128Type x, Vec128Type y) { return _mm_add_epi32(x, y); }
+    __AVX512__ static VecType vecMul(VecType x, VecType y) { return _mm512_mullo_epi32(x, y); }
+    __AVX512__ static VecType vecAdd(VecType x, VecType y) { return _mm512_add_epi32(x, y); }
+    __AVX512__ static Vec128Type squash2(VecType x, VecType y) {
+        return squash1(_mm512_add_epi32(x, y));        // [x0 + y0, x1 + y1, .., x15 + y15]
+    }
+
+    __AVX512__ static Vec128Type squash1(VecType z) {
+        return _mm_cvtsi32_si128(_mm512_reduce_add_epi32(z)); // [z0..15, 0, 0, 0]
+    }
+
+    __AVX512__ static int polyHashUnalignedUnrollUpTo32(int n, uint16_t const* str) {
+        Vec128Type res = initVec128();
+
+        polyHashUnroll2<AVX512Traits>(n, str, res, &b32x16[0], &p128[96]);
+        polyHashTail<AVX512Traits>(n, str, res, &b16x16[0], &p128[112]);
+        polyHashTail<AVX2Traits>(n, str, res, &b8[0], &p64[56]);
+        polyHashTail<SSETraits>(n, str, res, &b4[0], &p64[60]);
+
+        return vec128toInt(res);
+    }
+
+    __AVX512__ static int polyHashUnalignedUnrollUpTo64(int n, uint16_t const* str) {
+        Vec128Type res = initVec128();
+
+        polyHashUnroll4<AVX512Traits>(n, str, res, &b64x16[0], &p128[64]);
+        polyHashUnroll2<AVX512Traits>(n, str, res, &b32x16[0], &p128[96]);
+        polyHashTail<AVX512Traits>(n, str, res, &b16x16[0], &p128[112]);
+        polyHashTail<AVX2Traits>(n, str, res, &b8[0], &p64[56]);
+        polyHashTail<SSETraits>(n, str, res, &b4[0], &p64[60]);
+
+        return vec128toInt(res);
+    }
+
+    __AVX512__ static int polyHashUnalignedUnrollUpTo128(int n, uint16_t const* str) {
+        Vec128Type res = initVec128();
+
+        polyHashUnroll8<AVX512Traits>(n, str, res, &b128x16[0], &p128[0]);
+        polyHashUnroll4<AVX512Traits>(n, str, res, &b64x16[0], &p128[64]);
+        polyHashUnroll2<AVX512Traits>(n, str, res, &b32x16[0], &p128[96]);
+        polyHashTail<AVX512Traits>(n, str, res, &b16x16[0], &p128[112]);
+        polyHashTail<AVX2Traits>(n, str, res, &b8[0], &p64[56]);
+        polyHashTail<SSETraits>(n, str, res, &b4[0], &p64[60]);
+
+        return vec128toInt(res);
+    }
+};
+
 #if defined(__x86_64__)
     const bool x64 = true;
 #else
     const bool x64 = false;
 #endif
-    bool initialized = false;
-    bool sseSupported = false;
-    bool avx2Supported = false;
 
+// Handles the tail naively.
+ALWAYS_INLINE int polyHashTailNaive(int length, uint16_t const* str, uint32_t res) {
+    for (int i = length & 0xFFFFFFFC; i < length; ++i)
+        res = res * 31 + str[i];
+    return res;
 }
 
-int polyHash_x86(int length, uint16_t const* str) {
-    if (!initialized) {
-        initialized = true;
-        sseSupported = __builtin_cpu_supports("sse4.1");
-        avx2Supported = __builtin_cpu_supports("avx2");
-    }
-    if (length < 16 || (!sseSupported && !avx2Supported)) {
-        // Either vectorization is not supported or the string is too short to gain from it.
+}
+
+int polyHash_x86_sse41(int length, uint16_t const* str) {
+    if (length < 16) {
+        // The string is too short to gain from vectorization.
         return polyHash_naive(length, str);
     }
     uint32_t res;
     if (length < 32)
         res = SSETraits::polyHashUnalignedUnrollUpTo8(length / 4, str);
-    else if (!avx2Supported)
+    else
         res = SSETraits::polyHashUnalignedUnrollUpTo16(length / 4, str);
+    return polyHashTailNaive(length, str, res);
+}
+
+int polyHash_x86_avx2(int length, uint16_t const* str) {
+    if (length < 16) {
+        // The string is too short to gain from vectorization.
+        return polyHash_naive(length, str);
+    }
+    uint32_t res;
+    if (length < 32)
+        res = SSETraits::polyHashUnalignedUnrollUpTo8(length / 4, str);
     else if (length < 128)
         res = AVX2Traits::polyHashUnalignedUnrollUpTo16(length / 4, str);
     else if (!x64 || length < 576)
         res = AVX2Traits::polyHashUnalignedUnrollUpTo32(length / 4, str);
     else // Such big unrolling requires 64-bit mode (in 32-bit mode there are only 8 vector registers)
         res = AVX2Traits::polyHashUnalignedUnrollUpTo64(length / 4, str);
+    return polyHashTailNaive(length, str, res);
+}
 
-    // Handle the tail naively.
-    for (int i = length & 0xFFFFFFFC; i < length; ++i)
-        res = res * 31 + str[i];
-    return res;
+int polyHash_x86_avx512(int length, uint16_t const* str) {
+    // 512-bit multiplies may lower the core frequency, so keep short strings on narrower vectors.
+    if (length < 256)
+        return polyHash_x86_avx2(length, str);
+    uint32_t res;
+    if (length < 1024)
+        res = AVX512Traits::polyHashUnalignedUnrollUpTo32(length / 4, str);
+    else if (!x64 || length < 2048)
+        res = AVX512Traits::polyHashUnalignedUnrollUpTo64(length / 4, str);
+    else // Same as for AVX2, 8 accumulators only fit into 64-bit mode registers.
+        res = AVX512Traits::polyHashUnalignedUnrollUpTo128(length / 4, str);
+    return polyHashTailNaive(length, str, res);
+}
+
+PolyHashFunction* polyHashResolve_x86() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return polyHash_x86_avx512;
+    if (__builtin_cpu_supports("avx2"))
+        return polyHash_x86_avx2;
+    if (__builtin_cpu_supports("sse4.1"))
+        return polyHash_x86_sse41;
+    return polyHash_naive;
 }
 
 #endif
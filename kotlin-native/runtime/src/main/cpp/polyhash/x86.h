@@ -6,6 +6,14 @@
 #ifndef RUNTIME_POLYHASH_X86_H
 #define RUNTIME_POLYHASH_X86_H
 
-int polyHash_x86(int length, uint16_t const* str);
+#include "polyhash/PolyHash.h"
+
+// Each of these may only be called if the current CPU supports the corresponding instruction set.
+int polyHash_x86_sse41(int length, uint16_t const* str);
+int polyHash_x86_avx2(int length, uint16_t const* str);
+int polyHash_x86_avx512(int length, uint16_t const* str);
+
+// Picks the fastest implementation the current CPU supports.
+PolyHashFunction* polyHashResolve_x86();
 
 #endif  // RUNTIME_POLYHASH_X86_H
@@ -469,11 +469,7 @@ public actual infix fun <T> Array<out T>?.contentEquals(other: Array<out T>?): B
 public actual infix fun ByteArray?.contentEquals(other: ByteArray?): Boolean {
     if (this === other) return true
     if (this === null || other === null) return false
-    if (size != other.size) return false
-    for (i in indices) {
-        if (this[i] != other[i]) return false
-    }
-    return true
+    return arrayContentEquals(this, other)
 }
 
 /**
@@ -487,11 +483,7 @@ public actual infix fun ByteArray?.contentEquals(other: ByteArray?): Boolean {
 public actual infix fun ShortArray?.contentEquals(other: ShortArray?): Boolean {
     if (this === other) return true
     if (this === null || other === null) return false
-    if (size != other.size) return false
-    for (i in indices) {
-        if (this[i] != other[i]) return false
-    }
-    return true
+    return arrayContentEquals(this, other)
 }
 
 /**
@@ -505,11 +497,7 @@ public actual infix fun ShortArray?.contentEquals(other: ShortArray?): Boolean {
 public actual infix fun IntArray?.contentEquals(other: IntArray?): Boolean {
     if (this === other) return true
     if (this === null || other === null) return false
-    if (size != other.size) return false
-    for (i in indices) {
-        if (this[i] != other[i]) return false
-    }
-    return true
+    return arrayContentEquals(this, other)
 }
 
 /**
@@ -523,11 +511,7 @@ public actual infix fun IntArray?.contentEquals(other: IntArray?): Boolean {
 public actual infix fun LongArray?.contentEquals(other: LongArray?): Boolean {
     if (this === other) return true
     if (this === null || other === null) return false
-    if (size != other.size) return false
-    for (i in indices) {
-        if (this[i] != other[i]) return false
-    }
-    return true
+    return arrayContentEquals(this, other)
 }
 
 /**
@@ -577,11 +561,7 @@ public actual infix fun DoubleArray?.contentEquals(other: DoubleArray?): Boolean
 public actual infix fun BooleanArray?.contentEquals(other: BooleanArray?): Boolean {
     if (this === other) return true
     if (this === null || other === null) return false
-    if (size != other.size) return false
-    for (i in indices) {
-        if (this[i] != other[i]) return false
-    }
-    return true
+    return arrayContentEquals(this, other)
 }
 
 /**
@@ -595,11 +575,7 @@ public actual infix fun BooleanArray?.contentEquals(other: BooleanArray?): Boole
 public actual infix fun CharArray?.contentEquals(other: CharArray?): Boolean {
     if (this === other) return true
     if (this === null || other === null) return false
-    if (size != other.size) return false
-    for (i in indices) {
-        if (this[i] != other[i]) return false
-    }
-    return true
+    return arrayContentEquals(this, other)
 }
 
 /**
@@ -710,10 +686,7 @@ public actual fun <T> Array<out T>?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun ByteArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -722,10 +695,7 @@ public actual fun ByteArray?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun ShortArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -734,10 +704,7 @@ public actual fun ShortArray?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun IntArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -746,10 +713,7 @@ public actual fun IntArray?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun LongArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -758,10 +722,7 @@ public actual fun LongArray?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun FloatArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -770,10 +731,7 @@ public actual fun FloatArray?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun DoubleArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -782,10 +740,7 @@ public actual fun DoubleArray?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun BooleanArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -794,10 +749,7 @@ public actual fun BooleanArray?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun CharArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -0,0 +1,246 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package kotlin.math
+
+// Batch versions of math functions: compute a function of each element of a subrange of an array and store
+// the results into the destination array, which is the same array by default.
+//
+// exp, ln, sin and cos of many elements are computed with vectorized polynomial kernels. Their results are
+// within 1 ulp of the exact ones but may differ from the scalar functions in the last bit. Arguments outside of
+// the kernel ranges (non-finite values, subnormals, `|x| > 708` for exp, `|x| > 2^20` for sin and cos)
+// are computed with the scalar functions. Float elements are computed in double precision.
+//
+// As with copyInto, the destination range may overlap the source one.
+
+/**
+ * Stores e raised to the power of each element of this array from [startIndex] until [endIndex]
+ * into [destination] starting at [destinationOffset].
+ * @return the [destination] array.
+ * @throws IndexOutOfBoundsException when the subrange is out of range of this array indices
+ * or doesn't fit into the [destination] array starting at [destinationOffset].
+ * @see exp
+ */
+@SinceKotlin("1.5")
+@ExperimentalStdlibApi
+public fun DoubleArray.expInto(destination: DoubleArray = this, destinationOffset: Int = 0,
+        startIndex: Int = 0, endIndex: Int = size): DoubleArray {
+    expIntoImpl(startIndex, destination, destinationOffset, endIndex - startIndex)
+    return destination
+}
+
+/**
+ * Stores the natural logarithm of each element of this array from [startIndex] until [endIndex]
+ * into [destination] starting at [destinationOffset].
+ * @return the [destination] array.
+ * @throws IndexOutOfBoundsException when the subrange is out of range of this array indices
+ * or doesn't fit into the [destination] array starting at [destinationOffset].
+ * @see ln
+ */
+@SinceKotlin("1.5")
+@ExperimentalStdlibApi
+public fun DoubleArray.lnInto(destination: DoubleArray = this, destinationOffset: Int = 0,
+        startIndex: Int = 0, endIndex: Int = size): DoubleArray {
+    lnIntoImpl(startIndex, destination, destinationOffset, endIndex - startIndex)
+    return destination
+}
+
+/**
+ * Stores the sine of each element of this array from [startIndex] until [endIndex]
+ * into [destination] starting at [destinationOffset].
+ * @return the [destination] array.
+ * @throws IndexOutOfBoundsException when the subrange is out of range of this array indices
+ * or doesn't fit into the [destination] array starting at [destinationOffset].
+ * @see sin
+ */
+@SinceKotlin("1.5")
+@ExperimentalStdlibApi
+public fun DoubleArray.sinInto(destination: DoubleArray = this, destinationOffset: Int = 0,
+        startIndex: Int = 0, endIndex: Int = size): DoubleArray {
+    sinIntoImpl(startIndex, destination, destinationOffset, endIndex - startIndex)
+    return destination
+}
+
+/**
+ * Stores the cosine of each element of this array from [startIndex] until [endIndex]
+ * into [destination] starting at [destinationOffset].
+ * @return the [destination] array.
+ * @throws IndexOutOfBoundsException when the subrange is out of range of this array indices
+ * or doesn't fit into the [destination] array starting at [destinationOffset].
+ * @see cos
+ */
+@SinceKotlin("1.5")
+@ExperimentalStdlibApi
+public fun DoubleArray.cosInto(destination: DoubleArray = this, destinationOffset: Int = 0,
+        startIndex: Int = 0, endIndex: Int = size): DoubleArray {
+    cosIntoImpl(startIndex, destination, destinationOffset, endIndex - startIndex)
+    return destination
+}
+
+/**
+ * Stores the positive square root of each element of this array from [startIndex] until [endIndex]
+ * into [destination] starting at [destinationOffset].
+ * @return the [destination] array.
+ * @throws IndexOutOfBoundsException when the subrange is out of range of this array indices
+ * or doesn't fit into the [destination] array starting at [destinationOffset].
+ * @see sqrt
+ */
+@SinceKotlin("1.5")
+@ExperimentalStdlibApi
+public fun DoubleArray.sqrtInto(destination: DoubleArray = this, destinationOffset: Int = 0,
+        startIndex: Int = 0, endIndex: Int = size): DoubleArray {
+    sqrtIntoImpl(startIndex, destination, destinationOffset, endIndex - startIndex)
+    return destination
+}
+
+/**
+ * Stores each element of this array from [startIndex] until [endIndex] raised to the power [x] into [destination]
+ * starting at [destinationOffset].
+ * @return the [destination] array.
+ * @throws IndexOutOfBoundsException when the subrange is out of range of this array indices
+ * or doesn't fit into the [destination] array starting at [destinationOffset].
+ * @see pow
+ */
+@SinceKotlin("1.5")
+@ExperimentalStdlibApi
+public fun DoubleArray.powInto(x: Double, destination: DoubleArray = this, destinationOffset: Int = 0,
+        startIndex: Int = 0, endIndex: Int = size): DoubleArray {
+    powIntoImpl(startIndex, destination, destinationOffset, endIndex - startIndex, x)
+    return destination
+}
+
+/**
+ * Stores e raised to the power of each element of this array from [startIndex] until [endIndex]
+ * into [destination] starting at [destinationOffset].
+ * @return the [destination] array.
+ * @throws IndexOutOfBoundsException when the subrange is out of range of this array indices
+ * or doesn't fit into the [destination] array starting at [destinationOffset].
+ * @see exp
+ */
+@SinceKotlin("1.5")
+@ExperimentalStdlibApi
+public fun FloatArray.expInto(destination: FloatArray = this, destinationOffset: Int = 0,
+        startIndex: Int = 0, endIndex: Int = size): FloatArray {
+    expIntoImpl(startIndex, destination, destinationOffset, endIndex - startIndex)
+    return destination
+}
+
+/**
+ * Stores the natural logarithm of each element of this array from [startIndex] until [endIndex]
+ * into [destination] starting at [destinationOffset].
+ * @return the [destination] array.
+ * @throws IndexOutOfBoundsException when the subrange is out of range of this array indices
+ * or doesn't fit into the [destination] array starting at [destinationOffset].
+ * @see ln
+ */
+@SinceKotlin("1.5")
+@ExperimentalStdlibApi
+public fun FloatArray.lnInto(destination: FloatArray = this, destinationOffset: Int = 0,
+        startIndex: Int = 0, endIndex: Int = size): FloatArray {
+    lnIntoImpl(startIndex, destination, destinationOffset, endIndex - startIndex)
+    return destination
+}
+
+/**
+ * Stores the sine of each element of this array from [startIndex] until [endIndex]
+ * into [destination] starting at [destinationOffset].
+ * @return the [destination] array.
+ * @throws IndexOutOfBoundsException when the subrange is out of range of this array indices
+ * or doesn't fit into the [destination] array starting at [destinationOffset].
+ * @see sin
+ */
+@SinceKotlin("1.5")
+@ExperimentalStdlibApi
+public fun FloatArray.sinInto(destination: FloatArray = this, destinationOffset: Int = 0,
+        startIndex: Int = 0, endIndex: Int = size): FloatArray {
+    sinIntoImpl(startIndex, destination, destinationOffset, endIndex - startIndex)
+    return destination
+}
+
+/**
+ * Stores the cosine of each element of this array from [startIndex] until [endIndex]
+ * into [destination] starting at [destinationOffset].
+ * @return the [destination] array.
+ * @throws IndexOutOfBoundsException when the subrange is out of range of this array indices
+ * or doesn't fit into the [destination] array starting at [destinationOffset].
+ * @see cos
+ */
+@SinceKotlin("1.5")
+@ExperimentalStdlibApi
+public fun FloatArray.cosInto(destination: FloatArray = this, destinationOffset: Int = 0,
+        startIndex: Int = 0, endIndex: Int = size): FloatArray {
+    cosIntoImpl(startIndex, destination, destinationOffset, endIndex - startIndex)
+    return destination
+}
+
+/**
+ * Stores the positive square root of each element of this array from [startIndex] until [endIndex]
+ * into [destination] starting at [destinationOffset].
+ * @return the [destination] array.
+ * @throws IndexOutOfBoundsException when the subrange is out of range of this array indices
+ * or doesn't fit into the [destination] array starting at [destinationOffset].
+ * @see sqrt
+ */
+@SinceKotlin("1.5")
+@ExperimentalStdlibApi
+public fun FloatArray.sqrtInto(destination: FloatArray = this, destinationOffset: Int = 0,
+        startIndex: Int = 0, endIndex: Int = size): FloatArray {
+    sqrtIntoImpl(startIndex, destination, destinationOffset, endIndex - startIndex)
+    return destination
+}
+
+/**
+ * Stores each element of this array from [startIndex] until [endIndex] raised to the power [x] into [destination]
+ * starting at [destinationOffset].
+ * @return the [destination] array.
+ * @throws IndexOutOfBoundsException when the subrange is out of range of this array indices
+ * or doesn't fit into the [destination] array starting at [destinationOffset].
+ * @see pow
+ */
+@SinceKotlin("1.5")
+@ExperimentalStdlibApi
+public fun FloatArray.powInto(x: Float, destination: FloatArray = this, destinationOffset: Int = 0,
+        startIndex: Int = 0, endIndex: Int = size): FloatArray {
+    powIntoImpl(startIndex, destination, destinationOffset, endIndex - startIndex, x)
+    return destination
+}
+
+@SymbolName("Kotlin_DoubleArray_expInto")
+private external fun DoubleArray.expIntoImpl(fromIndex: Int, destination: DoubleArray, toIndex: Int, count: Int)
+
+@SymbolName("Kotlin_DoubleArray_lnInto")
+private external fun DoubleArray.lnIntoImpl(fromIndex: Int, destination: DoubleArray, toIndex: Int, count: Int)
+
+@SymbolName("Kotlin_DoubleArray_sinInto")
+private external fun DoubleArray.sinIntoImpl(fromIndex: Int, destination: DoubleArray, toIndex: Int, count: Int)
+
+@SymbolName("Kotlin_DoubleArray_cosInto")
+private external fun DoubleArray.cosIntoImpl(fromIndex: Int, destination: DoubleArray, toIndex: Int, count: Int)
+
+@SymbolName("Kotlin_DoubleArray_sqrtInto")
+private external fun DoubleArray.sqrtIntoImpl(fromIndex: Int, destination: DoubleArray, toIndex: Int, count: Int)
+
+@SymbolName("Kotlin_DoubleArray_powInto")
+private external fun DoubleArray.powIntoImpl(
+        fromIndex: Int, destination: DoubleArray, toIndex: Int, count: Int, x: Double)
+
+@SymbolName("Kotlin_FloatArray_expInto")
+private external fun FloatArray.expIntoImpl(fromIndex: Int, destination: FloatArray, toIndex: Int, count: Int)
+
+@SymbolName("Kotlin_FloatArray_lnInto")
+private external fun FloatArray.lnIntoImpl(fromIndex: Int, destination: FloatArray, toIndex: Int, count: Int)
+
+@SymbolName("Kotlin_FloatArray_sinInto")
+private external fun FloatArray.sinIntoImpl(fromIndex: Int, destination: FloatArray, toIndex: Int, count: Int)
+
+@SymbolName("Kotlin_FloatArray_cosInto")
+private external fun FloatArray.cosIntoImpl(fromIndex: Int, destination: FloatArray, toIndex: Int, count: Int)
+
+@SymbolName("Kotlin_FloatArray_sqrtInto")
+private external fun FloatArray.sqrtIntoImpl(fromIndex: Int, destination: FloatArray, toIndex: Int, count: Int)
+
+@SymbolName("Kotlin_FloatArray_powInto")
+private external fun FloatArray.powIntoImpl(
+        fromIndex: Int, destination: FloatArray, toIndex: Int, count: Int, x: Float)
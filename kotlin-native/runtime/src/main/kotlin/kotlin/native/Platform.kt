@@ -4,6 +4,10 @@
  */
 package kotlin.native
 
+import kotlin.native.internal.KClassImpl
+import kotlin.native.internal.NativePtr
+import kotlin.reflect.KClass
+
 /**
  * Operating system family.
  */
@@ -98,6 +102,74 @@ public object Platform {
     public var isCleanersLeakCheckerActive: Boolean
         get() = Platform_getCleanersLeakChecker()
         set(value) = Platform_setCleanersLeakChecker(value)
+
+    /**
+     * The number of workers executing Cleaner blocks, from 1 to 16, by default 1.
+     * Can only be set before the first cleaner is created. Cleaner blocks are distributed between the workers
+     * round-robin, so with more than one worker they may be executed in a different order than their objects are gone.
+     *
+     * @throws IllegalArgumentException if the value is not in `1..16`.
+     * @throws IllegalStateException if set after the first cleaner is created.
+     */
+    @SinceKotlin("1.5")
+    @ExperimentalStdlibApi
+    public var cleanerWorkersCount: Int
+        get() = Platform_getCleanerWorkersCount()
+        set(value) {
+            require(value in 1..16) { "Cleaner workers count must be between 1 and 16: $value" }
+            check(Platform_setCleanerWorkersCount(value)) {
+                "Cleaner workers count can't be changed after the first cleaner is created"
+            }
+        }
+
+    /**
+     * If strings decoded from UTF-8 at runtime (e.g. by [ByteArray.decodeToString] or [kotlinx.cinterop.toKString])
+     * are [interned][intern], by default `false`.
+     * Enabling it pays off when the same strings are decoded over and over again, e.g. keys of JSON documents.
+     * Cannot be enabled with the experimental memory model, which doesn't intern strings yet.
+     */
+    @SinceKotlin("1.5")
+    @ExperimentalStdlibApi
+    public var isStringInterningOnDecodeActive: Boolean
+        get() = Platform_getStringInterningOnDecode()
+        set(value) {
+            require(!value || memoryModel != MemoryModel.EXPERIMENTAL) {
+                "String interning is not supported with the experimental memory model"
+            }
+            Platform_setStringInterningOnDecode(value)
+        }
+
+    /**
+     * If sorting of large [IntArray], [LongArray], [FloatArray] and [DoubleArray] may use multiple threads,
+     * by default `false`.
+     * Helper threads only live for the duration of a single sort, the calling thread waits for them.
+     */
+    public var isParallelArraySortingActive: Boolean
+        get() = Platform_getParallelArraySorting()
+        set(value) = Platform_setParallelArraySorting(value)
+
+    /**
+     * The maximum number of frames captured in the stack trace of a new [Throwable], by default [Int.MAX_VALUE].
+     * `0` disables capturing stack traces, which makes creating exceptions cheaper, e.g. when they are used for control
+     * flow. Stack traces are only symbolicated when requested, e.g. by [Throwable.getStackTrace].
+     */
+    public var maxStackTraceDepth: Int
+        get() = Platform_getMaxStackTraceDepth()
+        set(value) {
+            require(value >= 0) { "Stack trace depth must not be negative: $value" }
+            Platform_setMaxStackTraceDepth(value)
+        }
+
+    /**
+     * Disables capturing stack traces of new exceptions of [exceptionClass] and its subclasses, so that they have
+     * empty stack traces. Up to 16 classes can be disabled.
+     */
+    public fun disableStackTraceCapture(exceptionClass: KClass<out Throwable>) {
+        require(exceptionClass is KClassImpl<*>) { "Unsupported class: $exceptionClass" }
+        check(Platform_disableStackTraceCapture(exceptionClass.typeInfo)) {
+            "Stack trace capture is already disabled for too many classes"
+        }
+    }
 }
 
 @SymbolName("Konan_Platform_canAccessUnaligned")
@@ -129,3 +201,30 @@ private external fun Platform_getCleanersLeakChecker(): Boolean
 
 @SymbolName("Konan_Platform_setCleanersLeakChecker")
 private external fun Platform_setCleanersLeakChecker(value: Boolean): Unit
+
+@SymbolName("Konan_Platform_getCleanerWorkersCount")
+private external fun Platform_getCleanerWorkersCount(): Int
+
+@SymbolName("Konan_Platform_setCleanerWorkersCount")
+private external fun Platform_setCleanerWorkersCount(value: Int): Boolean
+
+@SymbolName("Konan_Platform_getStringInterningOnDecode")
+private external fun Platform_getStringInterningOnDecode(): Boolean
+
+@SymbolName("Konan_Platform_setStringInterningOnDecode")
+private external fun Platform_setStringInterningOnDecode(value: Boolean): Unit
+
+@SymbolName("Konan_Platform_getParallelArraySorting")
+private external fun Platform_getParallelArraySorting(): Boolean
+
+@SymbolName("Konan_Platform_setParallelArraySorting")
+private external fun Platform_setParallelArraySorting(value: Boolean): Unit
+
+@SymbolName("Konan_Platform_getMaxStackTraceDepth")
+private external fun Platform_getMaxStackTraceDepth(): Int
+
+@SymbolName("Konan_Platform_setMaxStackTraceDepth")
+private external fun Platform_setMaxStackTraceDepth(value: Int): Unit
+
+@SymbolName("Konan_Platform_disableStackTraceCapture")
+private external fun Platform_disableStackTraceCapture(typeInfo: NativePtr): Boolean
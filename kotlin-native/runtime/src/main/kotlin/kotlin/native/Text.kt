@@ -123,6 +123,27 @@ public fun String.toUtf8OrThrow(start: Int = 0, size: Int = this.length) : ByteA
     }
 }
 
+/**
+ * Returns a canonical representation of this string: all strings equal to each other
+ * are interned to the same instance while that instance is in use.
+ *
+ * The intern table doesn't keep strings alive, unused interned strings are collected as usual.
+ * Interned strings are compared by [String.equals] without looking at their contents.
+ *
+ * @throws IllegalStateException with the experimental memory model, which doesn't support interning yet.
+ */
+@SinceKotlin("1.5")
+@ExperimentalStdlibApi
+public fun String.intern(): String {
+    check(Platform.memoryModel != MemoryModel.EXPERIMENTAL) {
+        "String interning is not supported with the experimental memory model"
+    }
+    return internImpl()
+}
+
+@SymbolName("Kotlin_String_intern")
+private external fun String.internImpl(): String
+
 internal fun checkBoundsIndexes(startIndex: Int, endIndex: Int, size: Int) {
     if (startIndex < 0 || endIndex > size) {
         throw IndexOutOfBoundsException("startIndex: $startIndex, endIndex: $endIndex, size: $size")
@@ -154,4 +175,7 @@ internal external fun unsafeStringFromCharArray(array: CharArray, start: Int, si
 internal external fun insertString(array: CharArray, distIndex: Int, value: String, sourceIndex: Int, count: Int): Int
 
 @SymbolName("Kotlin_StringBuilder_insertInt")
-internal external fun insertInt(array: CharArray, start: Int, value: Int): Int
\ No newline at end of file
+internal external fun insertInt(array: CharArray, start: Int, value: Int): Int
+
+@SymbolName("Kotlin_StringBuilder_insertLong")
+internal external fun insertLong(array: CharArray, start: Int, value: Long): Int
\ No newline at end of file
@@ -156,3 +156,174 @@ public external fun ByteArray.setFloatAt(index: Int, value: Float)
  */
 @SymbolName("Kotlin_ByteArray_setDoubleAt")
 public external fun ByteArray.setDoubleAt(index: Int, value: Double)
+
+// Bulk versions of the operations above: copy a run of primitive values between the byte buffer
+// and a primitive array in one call, checking the whole range once.
+
+/**
+ * Gets [count] [Char] values out of the [ByteArray] byte buffer starting at byte index [byteIndex]
+ * into [destination] starting at [destinationIndex].
+ * Values are in little-endian byte order unless [bigEndian] is set.
+ * @throws ArrayIndexOutOfBoundsException if any of the ranges is outside of array boundaries.
+ */
+public fun ByteArray.getCharsAt(byteIndex: Int, destination: CharArray, destinationIndex: Int = 0,
+        count: Int = destination.size - destinationIndex, bigEndian: Boolean = false) {
+    getCharsAtImpl(byteIndex, destination, destinationIndex, count, bigEndian)
+}
+
+/**
+ * Gets [count] [Short] values out of the [ByteArray] byte buffer starting at byte index [byteIndex]
+ * into [destination] starting at [destinationIndex].
+ * Values are in little-endian byte order unless [bigEndian] is set.
+ * @throws ArrayIndexOutOfBoundsException if any of the ranges is outside of array boundaries.
+ */
+public fun ByteArray.getShortsAt(byteIndex: Int, destination: ShortArray, destinationIndex: Int = 0,
+        count: Int = destination.size - destinationIndex, bigEndian: Boolean = false) {
+    getShortsAtImpl(byteIndex, destination, destinationIndex, count, bigEndian)
+}
+
+/**
+ * Gets [count] [Int] values out of the [ByteArray] byte buffer starting at byte index [byteIndex]
+ * into [destination] starting at [destinationIndex].
+ * Values are in little-endian byte order unless [bigEndian] is set.
+ * @throws ArrayIndexOutOfBoundsException if any of the ranges is outside of array boundaries.
+ */
+public fun ByteArray.getIntsAt(byteIndex: Int, destination: IntArray, destinationIndex: Int = 0,
+        count: Int = destination.size - destinationIndex, bigEndian: Boolean = false) {
+    getIntsAtImpl(byteIndex, destination, destinationIndex, count, bigEndian)
+}
+
+/**
+ * Gets [count] [Long] values out of the [ByteArray] byte buffer starting at byte index [byteIndex]
+ * into [destination] starting at [destinationIndex].
+ * Values are in little-endian byte order unless [bigEndian] is set.
+ * @throws ArrayIndexOutOfBoundsException if any of the ranges is outside of array boundaries.
+ */
+public fun ByteArray.getLongsAt(byteIndex: Int, destination: LongArray, destinationIndex: Int = 0,
+        count: Int = destination.size - destinationIndex, bigEndian: Boolean = false) {
+    getLongsAtImpl(byteIndex, destination, destinationIndex, count, bigEndian)
+}
+
+/**
+ * Gets [count] [Float] values out of the [ByteArray] byte buffer starting at byte index [byteIndex]
+ * into [destination] starting at [destinationIndex].
+ * Values are in little-endian byte order unless [bigEndian] is set.
+ * @throws ArrayIndexOutOfBoundsException if any of the ranges is outside of array boundaries.
+ */
+public fun ByteArray.getFloatsAt(byteIndex: Int, destination: FloatArray, destinationIndex: Int = 0,
+        count: Int = destination.size - destinationIndex, bigEndian: Boolean = false) {
+    getFloatsAtImpl(byteIndex, destination, destinationIndex, count, bigEndian)
+}
+
+/**
+ * Gets [count] [Double] values out of the [ByteArray] byte buffer starting at byte index [byteIndex]
+ * into [destination] starting at [destinationIndex].
+ * Values are in little-endian byte order unless [bigEndian] is set.
+ * @throws ArrayIndexOutOfBoundsException if any of the ranges is outside of array boundaries.
+ */
+public fun ByteArray.getDoublesAt(byteIndex: Int, destination: DoubleArray, destinationIndex: Int = 0,
+        count: Int = destination.size - destinationIndex, bigEndian: Boolean = false) {
+    getDoublesAtImpl(byteIndex, destination, destinationIndex, count, bigEndian)
+}
+
+/**
+ * Sets [count] [Char] values from [source] starting at [sourceIndex] into the [ByteArray] byte buffer
+ * starting at byte index [byteIndex].
+ * Values are in little-endian byte order unless [bigEndian] is set.
+ * @throws ArrayIndexOutOfBoundsException if any of the ranges is outside of array boundaries.
+ */
+public fun ByteArray.setCharsAt(byteIndex: Int, source: CharArray, sourceIndex: Int = 0,
+        count: Int = source.size - sourceIndex, bigEndian: Boolean = false) {
+    setCharsAtImpl(byteIndex, source, sourceIndex, count, bigEndian)
+}
+
+/**
+ * Sets [count] [Short] values from [source] starting at [sourceIndex] into the [ByteArray] byte buffer
+ * starting at byte index [byteIndex].
+ * Values are in little-endian byte order unless [bigEndian] is set.
+ * @throws ArrayIndexOutOfBoundsException if any of the ranges is outside of array boundaries.
+ */
+public fun ByteArray.setShortsAt(byteIndex: Int, source: ShortArray, sourceIndex: Int = 0,
+        count: Int = source.size - sourceIndex, bigEndian: Boolean = false) {
+    setShortsAtImpl(byteIndex, source, sourceIndex, count, bigEndian)
+}
+
+/**
+ * Sets [count] [Int] values from [source] starting at [sourceIndex] into the [ByteArray] byte buffer
+ * starting at byte index [byteIndex].
+ * Values are in little-endian byte order unless [bigEndian] is set.
+ * @throws ArrayIndexOutOfBoundsException if any of the ranges is outside of array boundaries.
+ */
+public fun ByteArray.setIntsAt(byteIndex: Int, source: IntArray, sourceIndex: Int = 0,
+        count: Int = source.size - sourceIndex, bigEndian: Boolean = false) {
+    setIntsAtImpl(byteIndex, source, sourceIndex, count, bigEndian)
+}
+
+/**
+ * Sets [count] [Long] values from [source] starting at [sourceIndex] into the [ByteArray] byte buffer
+ * starting at byte index [byteIndex].
+ * Values are in little-endian byte order unless [bigEndian] is set.
+ * @throws ArrayIndexOutOfBoundsException if any of the ranges is outside of array boundaries.
+ */
+public fun ByteArray.setLongsAt(byteIndex: Int, source: LongArray, sourceIndex: Int = 0,
+        count: Int = source.size - sourceIndex, bigEndian: Boolean = false) {
+    setLongsAtImpl(byteIndex, source, sourceIndex, count, bigEndian)
+}
+
+/**
+ * Sets [count] [Float] values from [source] starting at [sourceIndex] into the [ByteArray] byte buffer
+ * starting at byte index [byteIndex].
+ * Values are in little-endian byte order unless [bigEndian] is set.
+ * @throws ArrayIndexOutOfBoundsException if any of the ranges is outside of array boundaries.
+ */
+public fun ByteArray.setFloatsAt(byteIndex: Int, source: FloatArray, sourceIndex: Int = 0,
+        count: Int = source.size - sourceIndex, bigEndian: Boolean = false) {
+    setFloatsAtImpl(byteIndex, source, sourceIndex, count, bigEndian)
+}
+
+/**
+ * Sets [count] [Double] values from [source] starting at [sourceIndex] into the [ByteArray] byte buffer
+ * starting at byte index [byteIndex].
+ * Values are in little-endian byte order unless [bigEndian] is set.
+ * @throws ArrayIndexOutOfBoundsException if any of the ranges is outside of array boundaries.
+ */
+public fun ByteArray.setDoublesAt(byteIndex: Int, source: DoubleArray, sourceIndex: Int = 0,
+        count: Int = source.size - sourceIndex, bigEndian: Boolean = false) {
+    setDoublesAtImpl(byteIndex, source, sourceIndex, count, bigEndian)
+}
+
+@SymbolName("Kotlin_ByteArray_getCharsAt")
+private external fun ByteArray.getCharsAtImpl(byteIndex: Int, destination: CharArray, destinationIndex: Int, count: Int, bigEndian: Boolean)
+
+@SymbolName("Kotlin_ByteArray_getShortsAt")
+private external fun ByteArray.getShortsAtImpl(byteIndex: Int, destination: ShortArray, destinationIndex: Int, count: Int, bigEndian: Boolean)
+
+@SymbolName("Kotlin_ByteArray_getIntsAt")
+private external fun ByteArray.getIntsAtImpl(byteIndex: Int, destination: IntArray, destinationIndex: Int, count: Int, bigEndian: Boolean)
+
+@SymbolName("Kotlin_ByteArray_getLongsAt")
+private external fun ByteArray.getLongsAtImpl(byteIndex: Int, destination: LongArray, destinationIndex: Int, count: Int, bigEndian: Boolean)
+
+@SymbolName("Kotlin_ByteArray_getFloatsAt")
+private external fun ByteArray.getFloatsAtImpl(byteIndex: Int, destination: FloatArray, destinationIndex: Int, count: Int, bigEndian: Boolean)
+
+@SymbolName("Kotlin_ByteArray_getDoublesAt")
+private external fun ByteArray.getDoublesAtImpl(byteIndex: Int, destination: DoubleArray, destinationIndex: Int, count: Int, bigEndian: Boolean)
+
+@SymbolName("Kotlin_ByteArray_setCharsAt")
+private external fun ByteArray.setCharsAtImpl(byteIndex: Int, source: CharArray, sourceIndex: Int, count: Int, bigEndian: Boolean)
+
+@SymbolName("Kotlin_ByteArray_setShortsAt")
+private external fun ByteArray.setShortsAtImpl(byteIndex: Int, source: ShortArray, sourceIndex: Int, count: Int, bigEndian: Boolean)
+
+@SymbolName("Kotlin_ByteArray_setIntsAt")
+private external fun ByteArray.setIntsAtImpl(byteIndex: Int, source: IntArray, sourceIndex: Int, count: Int, bigEndian: Boolean)
+
+@SymbolName("Kotlin_ByteArray_setLongsAt")
+private external fun ByteArray.setLongsAtImpl(byteIndex: Int, source: LongArray, sourceIndex: Int, count: Int, bigEndian: Boolean)
+
+@SymbolName("Kotlin_ByteArray_setFloatsAt")
+private external fun ByteArray.setFloatsAtImpl(byteIndex: Int, source: FloatArray, sourceIndex: Int, count: Int, bigEndian: Boolean)
+
+@SymbolName("Kotlin_ByteArray_setDoublesAt")
+private external fun ByteArray.setDoublesAtImpl(byteIndex: Int, source: DoubleArray, sourceIndex: Int, count: Int, bigEndian: Boolean)
@@ -88,26 +88,66 @@ fun <T> createCleaner(argument: T, block: (T) -> Unit): Cleaner {
 }
 
 /**
- * Perform GC on a worker that executes Cleaner blocks.
+ * Perform GC on workers that execute Cleaner blocks.
  */
 @InternalForKotlinNative
-fun performGCOnCleanerWorker() =
-    getCleanerWorker().execute(TransferMode.SAFE, {}) {
-        GC.collect()
-    }.result
+fun performGCOnCleanerWorker() {
+    for (index in 0 until getCleanerWorkersCount()) {
+        getCleanerWorkerAt(index).execute(TransferMode.SAFE, {}) {
+            GC.collect()
+        }.result
+    }
+}
+
+/**
+ * Wait for workers that execute Cleaner blocks to complete their scheduled tasks.
+ */
+@InternalForKotlinNative
+fun waitCleanerWorker() {
+    for (index in 0 until getCleanerWorkersCount()) {
+        getCleanerWorkerAt(index).execute(TransferMode.SAFE, {}) {
+            Unit
+        }.result
+    }
+}
+
+/**
+ * The number of Cleaner blocks whose objects are gone, but which have not been executed yet.
+ */
+@InternalForKotlinNative
+@SymbolName("Kotlin_CleanerImpl_getPendingCleanersCount")
+external fun getPendingCleanersCount(): Int
 
 /**
- * Wait for a worker that executes Cleaner blocks to complete its scheduled tasks.
+ * The maximum of [getPendingCleanersCount] since the program start.
  */
 @InternalForKotlinNative
-fun waitCleanerWorker() =
-    getCleanerWorker().execute(TransferMode.SAFE, {}) {
-        Unit
-    }.result
+@SymbolName("Kotlin_CleanerImpl_getPeakPendingCleanersCount")
+external fun getPeakPendingCleanersCount(): Int
+
+/**
+ * The number of Cleaner blocks executed since the program start.
+ */
+@InternalForKotlinNative
+@SymbolName("Kotlin_CleanerImpl_getExecutedCleanersCount")
+external fun getExecutedCleanersCount(): Int
+
+/**
+ * The maximum time in microseconds a Cleaner block waited for execution after its object was gone.
+ */
+@InternalForKotlinNative
+@SymbolName("Kotlin_CleanerImpl_getMaxCleanerLagMicros")
+external fun getMaxCleanerLagMicros(): Int
 
 @SymbolName("Kotlin_CleanerImpl_getCleanerWorker")
 external private fun getCleanerWorker(): Worker
 
+@SymbolName("Kotlin_CleanerImpl_getCleanerWorkersCount")
+external private fun getCleanerWorkersCount(): Int
+
+@SymbolName("Kotlin_CleanerImpl_getCleanerWorkerAt")
+external private fun getCleanerWorkerAt(index: Int): Worker
+
 @ExportForCppRuntime("Kotlin_CleanerImpl_shutdownCleanerWorker")
 private fun shutdownCleanerWorker(worker: Worker, executeScheduledCleaners: Boolean) {
     worker.requestTermination(executeScheduledCleaners).result
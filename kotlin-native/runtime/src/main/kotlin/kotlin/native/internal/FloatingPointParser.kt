@@ -34,6 +34,15 @@ import kotlin.comparisons.*
 @SymbolName("Kotlin_native_FloatingPointParser_parseDoubleImpl")
 private external fun parseDoubleImpl(s: String, e: Int): Double
 
+/**
+ * Parses the String if it is a plain decimal with at most 19 significant digits, without any allocations.
+ *
+ * @param s the String that will be parsed to a floating point
+ * @return the double closest to the real number, or NaN if the String must be parsed by [FloatingPointParser.parseDouble]
+ */
+@SymbolName("Kotlin_native_FloatingPointParser_parseDoubleFast")
+private external fun parseDoubleFast(s: String): Double
+
 /**
  * Takes a String and an integer exponent. The String should hold a positive
  * integer value (or zero). The exponent will be used to calculate the
@@ -293,6 +302,10 @@ object FloatingPointParser {
      * @exception NumberFormatException if the String doesn't represent a double
      */
     fun parseDouble(string: String): Double {
+        val fast = parseDoubleFast(string)
+        if (!fast.isNaN())
+            return fast
+
         var s = string
         s = s.trim { it <= ' ' }
         val length = s.length
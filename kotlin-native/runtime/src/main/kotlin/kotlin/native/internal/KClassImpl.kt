@@ -8,7 +8,7 @@ package kotlin.native.internal
 import kotlin.reflect.KClass
 
 @ExportForCompiler
-internal class KClassImpl<T : Any>(private val typeInfo: NativePtr) : KClass<T> {
+internal class KClassImpl<T : Any>(internal val typeInfo: NativePtr) : KClass<T> {
     override val simpleName: String?
         get() {
             val relativeName = getRelativeName(typeInfo)
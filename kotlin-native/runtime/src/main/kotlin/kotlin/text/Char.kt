@@ -12,12 +12,8 @@ import kotlin.IllegalArgumentException
  *
  * A character is considered to be defined in Unicode if its [category] is not [CharCategory.UNASSIGNED].
  */
-public actual fun Char.isDefined(): Boolean {
-    if (this < '\u0080') {
-        return true
-    }
-    return getCategoryValue() != CharCategory.UNASSIGNED.value
-}
+@SymbolName("Kotlin_Char_isDefined")
+external public actual fun Char.isDefined(): Boolean
 
 /**
  * Returns `true` if this character is a letter.
@@ -27,15 +23,8 @@ public actual fun Char.isDefined(): Boolean {
  *
  * @sample samples.text.Chars.isLetter
  */
-public actual fun Char.isLetter(): Boolean {
-    if (this in 'a'..'z' || this in 'A'..'Z') {
-        return true
-    }
-    if (this < '\u0080') {
-        return false
-    }
-    return isLetterImpl()
-}
+@SymbolName("Kotlin_Char_isLetter")
+external public actual fun Char.isLetter(): Boolean
 
 /**
  * Returns `true` if this character is a letter or digit.
@@ -45,16 +34,8 @@ public actual fun Char.isLetter(): Boolean {
  *
  * @sample samples.text.Chars.isLetterOrDigit
  */
-public actual fun Char.isLetterOrDigit(): Boolean {
-    if (this in 'a'..'z' || this in 'A'..'Z' || this in '0'..'9') {
-        return true
-    }
-    if (this < '\u0080') {
-        return false
-    }
-
-    return isDigit() || isLetter()
-}
+@SymbolName("Kotlin_Char_isLetterOrDigit")
+external public actual fun Char.isLetterOrDigit(): Boolean
 
 /**
  * Returns `true` if this character is a digit.
@@ -63,15 +44,8 @@ public actual fun Char.isLetterOrDigit(): Boolean {
  *
  * @sample samples.text.Chars.isDigit
  */
-public actual fun Char.isDigit(): Boolean {
-    if (this in '0'..'9') {
-        return true
-    }
-    if (this < '\u0080') {
-        return false
-    }
-    return isDigitImpl()
-}
+@SymbolName("Kotlin_Char_isDigit")
+external public actual fun Char.isDigit(): Boolean
 
 /**
  * Returns `true` if this character (Unicode code point) should be regarded as an ignorable
@@ -96,7 +70,8 @@ external public actual fun Char.isISOControl(): Boolean
  *
  * @sample samples.text.Chars.isWhitespace
  */
-public actual fun Char.isWhitespace(): Boolean = isWhitespaceImpl()
+@SymbolName("Kotlin_Char_isWhitespace")
+external public actual fun Char.isWhitespace(): Boolean
 
 /**
  * Returns `true` if this character is an upper case letter.
@@ -105,15 +80,8 @@ public actual fun Char.isWhitespace(): Boolean = isWhitespaceImpl()
  *
  * @sample samples.text.Chars.isUpperCase
  */
-public actual fun Char.isUpperCase(): Boolean {
-    if (this in 'A'..'Z') {
-        return true
-    }
-    if (this < '\u0080') {
-        return false
-    }
-    return isUpperCaseImpl()
-}
+@SymbolName("Kotlin_Char_isUpperCase")
+external public actual fun Char.isUpperCase(): Boolean
 
 /**
  * Returns `true` if this character is a lower case letter.
@@ -122,15 +90,8 @@ public actual fun Char.isUpperCase(): Boolean {
  *
  * @sample samples.text.Chars.isLowerCase
  */
-public actual fun Char.isLowerCase(): Boolean {
-    if (this in 'a'..'z') {
-        return true
-    }
-    if (this < '\u0080') {
-        return false
-    }
-    return isLowerCaseImpl()
-}
+@SymbolName("Kotlin_Char_isLowerCase")
+external public actual fun Char.isLowerCase(): Boolean
 
 /**
  * Returns `true` if this character is a title case letter.
@@ -140,17 +101,13 @@ public actual fun Char.isLowerCase(): Boolean {
  * @sample samples.text.Chars.isTitleCase
  */
 @SinceKotlin("1.5")
-public actual fun Char.isTitleCase(): Boolean {
-    if (this < '\u0080') {
-        return false
-    }
-    return getCategoryValue() == CharCategory.TITLECASE_LETTER.value
-}
+@SymbolName("Kotlin_Char_isTitleCase")
+external public actual fun Char.isTitleCase(): Boolean
 
 /**
  * Converts this character to upper case using Unicode mapping rules of the invariant locale.
  */
-public actual fun Char.toUpperCase(): Char = uppercaseCharImpl()
+public actual fun Char.toUpperCase(): Char = uppercaseChar()
 
 /**
  * Converts this character to upper case using Unicode mapping rules of the invariant locale.
@@ -163,7 +120,8 @@ public actual fun Char.toUpperCase(): Char = uppercaseCharImpl()
  */
 @SinceKotlin("1.4")
 @ExperimentalStdlibApi
-public actual fun Char.uppercaseChar(): Char = uppercaseCharImpl()
+@SymbolName("Kotlin_Char_uppercaseChar")
+external public actual fun Char.uppercaseChar(): Char
 
 /**
  * Converts this character to upper case using Unicode mapping rules of the invariant locale.
@@ -182,7 +140,7 @@ public actual fun Char.uppercase(): String = uppercaseImpl()
 /**
  * Converts this character to lower case using Unicode mapping rules of the invariant locale.
  */
-public actual fun Char.toLowerCase(): Char = lowercaseCharImpl()
+public actual fun Char.toLowerCase(): Char = lowercaseChar()
 
 /**
  * Converts this character to lower case using Unicode mapping rules of the invariant locale.
@@ -195,7 +153,8 @@ public actual fun Char.toLowerCase(): Char = lowercaseCharImpl()
  */
 @SinceKotlin("1.4")
 @ExperimentalStdlibApi
-public actual fun Char.lowercaseChar(): Char = lowercaseCharImpl()
+@SymbolName("Kotlin_Char_lowercaseChar")
+external public actual fun Char.lowercaseChar(): Char
 
 /**
  * Converts this character to lower case using Unicode mapping rules of the invariant locale.
@@ -221,7 +180,8 @@ public actual fun Char.lowercase(): String = lowercaseImpl()
  * @sample samples.text.Chars.titlecase
  */
 @SinceKotlin("1.5")
-public actual fun Char.titlecaseChar(): Char = titlecaseCharImpl()
+@SymbolName("Kotlin_Char_titlecaseChar")
+external public actual fun Char.titlecaseChar(): Char
 
 /**
  * Returns `true` if this character is a Unicode high-surrogate code unit (also known as leading-surrogate code unit).
@@ -245,7 +205,13 @@ external internal fun digitOfChecked(char: Char, radix: Int): Int
  * Returns the Unicode general category of this character.
  */
 public actual val Char.category: CharCategory
-    get() = CharCategory.valueOf(getCategoryValue())
+    get() = CharCategory.valueOf(categoryValue())
+
+/**
+ * Returns the Unicode general category of this character as an Int.
+ */
+@SymbolName("Kotlin_Char_getCategoryValue")
+external internal fun Char.categoryValue(): Int
 
 /**
  * Checks whether the given [radix] is valid radix for string to number and number to string conversion.
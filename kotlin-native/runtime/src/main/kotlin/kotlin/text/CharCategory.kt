@@ -161,7 +161,7 @@ public actual enum class CharCategory(public val value: Int, public actual val c
     /**
      * Returns `true` if [char] character belongs to this category.
      */
-    public actual operator fun contains(char: Char): Boolean = char.getCategoryValue() == this.value
+    public actual operator fun contains(char: Char): Boolean = char.categoryValue() == this.value
 
     public companion object {
         public fun valueOf(category: Int): CharCategory =
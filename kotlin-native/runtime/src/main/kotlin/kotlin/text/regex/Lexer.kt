@@ -783,6 +783,12 @@ internal class Lexer(val patternString: String, flags: Int) {
         const val TCount = 28
         const val NCount = 588
 
+        /**
+         * Chars below it, ASCII and most of Latin-1, have no decompositions and a zero canonical class,
+         * so strings of them are normalized already.
+         */
+        private const val FIRST_DECOMPOSABLE_CHAR = '\u00C0'
+
         // Access to the decomposition tables. =========================================================================
         /** Gets canonical class for given codepoint from decomposition mappings table. */
         fun getCanonicalClass(ch: Int): Int = getCanonicalClassInternal(ch)
@@ -806,6 +812,9 @@ internal class Lexer(val patternString: String, flags: Int) {
          * Normalize given string.
          */
         fun normalize(input: String): String {
+            if (input.all { it < FIRST_DECOMPOSABLE_CHAR }) {
+                return input
+            }
             val inputChars = input.toCharArray()
             val inputLength = inputChars.size
             var inputCodePointsIndex = 0
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ConservativeStack.hpp"
+
+#if KONAN_WINDOWS
+#include <windows.h>
+#elif !KONAN_NO_THREADS
+#include <pthread.h>
+#endif
+
+#include "KAssert.h"
+
+using namespace kotlin;
+
+// This global is overriden by the compiler.
+RUNTIME_WEAK int32_t Kotlin_conservativeStackScanning = 0;
+
+namespace {
+
+// The highest address of the current thread's stack, or `nullptr` if it's unknown on this target.
+void* StackBottom() noexcept {
+#if KONAN_WINDOWS
+    return reinterpret_cast<NT_TIB*>(NtCurrentTeb())->StackBase;
+#elif KONAN_MACOSX || KONAN_IOS || KONAN_TVOS || KONAN_WATCHOS
+    return pthread_get_stackaddr_np(pthread_self());
+#elif KONAN_LINUX || KONAN_ANDROID
+    pthread_attr_t attributes;
+    if (pthread_getattr_np(pthread_self(), &attributes) != 0) return nullptr;
+    void* address = nullptr;
+    size_t size = 0;
+    int result = pthread_attr_getstack(&attributes, &address, &size);
+    pthread_attr_destroy(&attributes);
+    if (result != 0) return nullptr;
+    return static_cast<char*>(address) + size;
+#else
+    return nullptr;
+#endif
+}
+
+} // namespace
+
+mm::ConservativeStack::ConservativeStack() noexcept : bottom_(static_cast<void* const*>(StackBottom())) {}
+
+NO_INLINE void mm::ConservativeStack::SavePosition() noexcept {
+    // Not `setjmp`, which saves the signal mask with a syscall on Apple platforms.
+#if KONAN_WINDOWS
+    setjmp(registers_);
+#else
+    _setjmp(registers_);
+#endif
+    // Callers' frames are above the frame of this function.
+    top_ = static_cast<void* const*>(__builtin_frame_address(0));
+    RuntimeAssert(
+            bottom_ == nullptr || top_ < bottom_, "Stack position %p is not above the stack bottom %p", top_, bottom_);
+}
+
+mm::ConservativeStack::Iterator mm::ConservativeStack::begin() const noexcept {
+    RuntimeCheck(Supported(), "Conservative stack scanning is not supported on this target");
+    if (top_ == nullptr) return end();
+    return Iterator(Registers(), RegistersEnd(), top_, bottom_);
+}
+
+mm::ConservativeStack::Iterator mm::ConservativeStack::end() const noexcept {
+    return Iterator(bottom_, bottom_, bottom_, bottom_);
+}
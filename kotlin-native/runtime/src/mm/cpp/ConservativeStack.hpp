@@ -0,0 +1,98 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_MM_CONSERVATIVE_STACK_H
+#define RUNTIME_MM_CONSERVATIVE_STACK_H
+
+#include <csetjmp>
+#include <cstddef>
+#include <cstdint>
+
+#include "Common.h"
+#include "Utils.hpp"
+
+// This global is overriden by the compiler. When set, the compiler doesn't register frames in `ShadowStack`,
+// and stacks must be scanned with `ConservativeStack`.
+extern "C" int32_t Kotlin_conservativeStackScanning;
+
+namespace kotlin {
+namespace mm {
+
+// Accessing the native stack of a thread without any help from the compiler: every aligned word of it, and of the
+// registers saved with the stack position, may be an object reference. Words have to be checked against
+// `ObjectIndex`, and objects found this way can never be moved, as the words referencing them can't be updated.
+//
+// The owner thread saves its position before letting other threads scan its stack (when switching to native code and
+// at safe points, see `ThreadData::SaveStackPosition`), and the stack above that position must not change until the
+// scan is done.
+class ConservativeStack : private Pinned {
+public:
+    class Iterator {
+    public:
+        Iterator(void* const* word, void* const* end, void* const* nextWord, void* const* nextEnd) noexcept :
+            word_(word), end_(end), nextWord_(nextWord), nextEnd_(nextEnd) {
+            Init();
+        }
+
+        void* operator*() const noexcept { return ReadWord(word_); }
+
+        Iterator& operator++() noexcept {
+            ++word_;
+            Init();
+            return *this;
+        }
+
+        bool operator==(const Iterator& rhs) const noexcept { return word_ == rhs.word_; }
+        bool operator!=(const Iterator& rhs) const noexcept { return !(*this == rhs); }
+
+    private:
+        void Init() noexcept {
+            if (word_ != end_) return;
+            word_ = nextWord_;
+            end_ = nextEnd_;
+            nextWord_ = nextEnd_;
+        }
+
+        void* const* word_;
+        void* const* end_;
+        void* const* nextWord_;
+        void* const* nextEnd_;
+    };
+
+    static bool IsEnabled() noexcept { return Kotlin_conservativeStackScanning != 0; }
+
+    // Stack words may lie in ASan redzones of other frames, so they can't be read with instrumented loads.
+    NO_SANITIZE_ADDRESS static void* ReadWord(void* const* word) noexcept { return *word; }
+
+    // Must be constructed on the thread whose stack it describes.
+    ConservativeStack() noexcept;
+
+    // Saves callee-saved registers and the current top of the stack. Kotlin code keeps frame pointers, so registers
+    // that some libcs mangle in `jmp_buf` (frame and stack pointers, return addresses) never hold references.
+    NO_INLINE void SavePosition() noexcept;
+
+    bool Supported() const noexcept { return bottom_ != nullptr; }
+
+    // Saved registers first, then the stack from the saved position to the bottom.
+    Iterator begin() const noexcept;
+    Iterator end() const noexcept;
+
+private:
+    void* const* Registers() const noexcept { return reinterpret_cast<void* const*>(&registers_); }
+    void* const* RegistersEnd() const noexcept {
+        constexpr size_t kRegistersSize = sizeof(registers_);
+        return Registers() + kRegistersSize / sizeof(void*);
+    }
+
+    // The stack grows down: `bottom_` is the highest address of it, `top_` is the lowest one being used.
+    void* const* bottom_ = nullptr;
+    void* const* top_ = nullptr;
+    std::jmp_buf registers_;
+};
+
+} // namespace mm
+} // namespace kotlin
+
+#endif // RUNTIME_MM_CONSERVATIVE_STACK_H
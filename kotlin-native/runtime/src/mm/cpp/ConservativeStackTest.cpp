@@ -0,0 +1,76 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ConservativeStack.hpp"
+
+#include <atomic>
+#include <thread>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "Types.h"
+
+using namespace kotlin;
+
+namespace {
+
+KStdVector<void*> Collect(const mm::ConservativeStack& stack) {
+    KStdVector<void*> result;
+    for (void* word : stack) {
+        result.push_back(word);
+    }
+    return result;
+}
+
+// Keeps `value` in this frame, which is above the saved position.
+NO_INLINE KStdVector<void*> CollectWithLocal(mm::ConservativeStack& stack, void* value) {
+    void* volatile local = value;
+    stack.SavePosition();
+    auto result = Collect(stack);
+    EXPECT_THAT(local, value);
+    return result;
+}
+
+} // namespace
+
+TEST(ConservativeStackTest, Empty) {
+    mm::ConservativeStack stack;
+    ASSERT_TRUE(stack.Supported());
+
+    EXPECT_THAT(Collect(stack), testing::IsEmpty());
+}
+
+TEST(ConservativeStackTest, FindLocal) {
+    mm::ConservativeStack stack;
+    int marker = 0;
+
+    auto actual = CollectWithLocal(stack, &marker);
+
+    EXPECT_THAT(actual, testing::Contains(&marker));
+}
+
+TEST(ConservativeStackTest, ScanOtherThread) {
+    int marker = 0;
+    std::atomic<mm::ConservativeStack*> stack(nullptr);
+    std::atomic<bool> done(false);
+    std::thread thread([&marker, &stack, &done] {
+        mm::ConservativeStack threadStack;
+        void* volatile local = &marker;
+        threadStack.SavePosition();
+        stack = &threadStack;
+        while (!done) {
+        }
+        EXPECT_THAT(local, &marker);
+    });
+    while (stack == nullptr) {
+    }
+
+    auto actual = Collect(*stack);
+    done = true;
+    thread.join();
+
+    EXPECT_THAT(actual, testing::Contains(&marker));
+}
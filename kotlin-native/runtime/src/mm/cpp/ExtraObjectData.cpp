@@ -5,6 +5,7 @@
 
 #include "ExtraObjectData.hpp"
 
+#include "FixedSizePool.hpp"
 #include "PointerBits.h"
 #include "Weak.h"
 
@@ -26,6 +27,9 @@ ALWAYS_INLINE T UnsafeRead(T* location) noexcept {
 #endif
 }
 
+// Objects used as weak reference targets need one each, so they are allocated from slabs rather than one by one.
+FixedSizePool<sizeof(mm::ExtraObjectData), alignof(mm::ExtraObjectData)> extraObjectDataPool [[clang::no_destroy]];
+
 } // namespace
 
 // static
@@ -41,12 +45,12 @@ mm::ExtraObjectData& mm::ExtraObjectData::Install(ObjHeader* object) noexcept {
 
     RuntimeCheck(!hasPointerBits(typeInfo, OBJECT_TAG_MASK), "Object must not be tagged");
 
-    auto* data = new ExtraObjectData(typeInfo);
+    auto* data = new (extraObjectDataPool.Allocate()) ExtraObjectData(typeInfo);
 
     TypeInfo* old = __sync_val_compare_and_swap(&object->typeInfoOrMeta_, typeInfo, reinterpret_cast<TypeInfo*>(data));
     if (old != typeInfo) {
         // Somebody else created `mm::ExtraObjectData` for this object
-        delete data;
+        Destroy(data);
         return *reinterpret_cast<mm::ExtraObjectData*>(old);
     }
 
@@ -61,7 +65,13 @@ void mm::ExtraObjectData::Uninstall(ObjHeader* object) noexcept {
 
     *const_cast<const TypeInfo**>(&object->typeInfoOrMeta_) = data.typeInfo_;
 
-    delete &data;
+    Destroy(&data);
+}
+
+// static
+void mm::ExtraObjectData::Destroy(ExtraObjectData* data) noexcept {
+    data->~ExtraObjectData();
+    extraObjectDataPool.Free(data);
 }
 
 mm::ExtraObjectData::~ExtraObjectData() {
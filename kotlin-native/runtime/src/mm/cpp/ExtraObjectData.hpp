@@ -9,7 +9,6 @@
 #include <cstddef>
 #include <cstdint>
 
-#include "Alloc.h"
 #include "Memory.h"
 #include "TypeInfo.h"
 #include "Utils.hpp"
@@ -18,7 +17,7 @@ namespace kotlin {
 namespace mm {
 
 // Optional data that's lazily allocated only for objects that need it.
-class ExtraObjectData : private Pinned, public KonanAllocatorAware {
+class ExtraObjectData : private Pinned {
 public:
     MetaObjHeader* AsMetaObjHeader() noexcept { return reinterpret_cast<MetaObjHeader*>(this); }
     static ExtraObjectData& FromMetaObjHeader(MetaObjHeader* header) noexcept { return *reinterpret_cast<ExtraObjectData*>(header); }
@@ -36,6 +35,8 @@ private:
     explicit ExtraObjectData(const TypeInfo* typeInfo) noexcept : typeInfo_(typeInfo) {}
     ~ExtraObjectData();
 
+    static void Destroy(ExtraObjectData* data) noexcept;
+
     // Must be first to match `TypeInfo` layout.
     const TypeInfo* typeInfo_;
 
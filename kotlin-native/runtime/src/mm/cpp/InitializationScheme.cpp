@@ -7,7 +7,9 @@
 
 #include "Common.h"
 #include "ObjectOps.hpp"
+#include "SingletonLock.hpp"
 #include "ThreadData.hpp"
+#include "ThreadState.hpp"
 
 using namespace kotlin;
 
@@ -35,18 +37,22 @@ OBJ_GETTER(mm::InitThreadLocalSingleton, ThreadData* threadData, ObjHeader** loc
 OBJ_GETTER(mm::InitSingleton, ThreadData* threadData, ObjHeader** location, const TypeInfo* typeInfo, void (*ctor)(ObjHeader*)) {
     auto& initializingSingletons = threadData->initializingSingletons();
 
-    // Search from the top of the stack.
-    for (auto it = initializingSingletons.rbegin(); it != initializingSingletons.rend(); ++it) {
-        if (it->first == location) {
-            RETURN_OBJ(it->second);
+    // Only a singleton being initialized may be initialized by this thread.
+    if (__atomic_load_n(location, __ATOMIC_ACQUIRE) == kInitializingSingleton) {
+        // Search from the top of the stack.
+        for (auto it = initializingSingletons.rbegin(); it != initializingSingletons.rend(); ++it) {
+            if (it->first == location) {
+                RETURN_OBJ(it->second);
+            }
         }
     }
 
-    ObjHeader* initializing = kInitializingSingleton;
-
-    // Spin lock.
     ObjHeader* value = nullptr;
-    while ((value = __sync_val_compare_and_swap(location, nullptr, initializing)) == initializing) {
+    if (!TryLockSingleton(location, value)) {
+        // The initializing thread may stop the world for a GC, which must not wait for this one while it sleeps.
+        auto oldState = SwitchThreadState(threadData, ThreadState::kNative);
+        value = WaitForSingleton(location);
+        SwitchThreadState(threadData, oldState);
     }
     if (value != nullptr) {
         // Initialized by someone else.
@@ -63,12 +69,14 @@ OBJ_GETTER(mm::InitSingleton, ThreadData* threadData, ObjHeader** location, cons
     } catch (...) {
         mm::SetStackRef(OBJ_RESULT, nullptr);
         mm::SetHeapRefAtomic(location, nullptr);
+        WakeSingletonWaiters(location);
         initializingSingletons.pop_back();
         throw;
     }
 #endif
     mm::GlobalsRegistry::Instance().RegisterStorageForGlobal(threadData, location);
     mm::SetHeapRefAtomic(location, object);
+    WakeSingletonWaiters(location);
     initializingSingletons.pop_back();
     return object;
 }
@@ -258,3 +258,30 @@ TEST_F(InitSingletonTest, InitSingletonConcurrentFailing) {
     EXPECT_THAT(location, nullptr);
     EXPECT_THAT(stackLocations, testing::Each(nullptr));
 }
+
+TEST_F(InitSingletonTest, InitSingletonWaitsInNativeState) {
+    ObjHeader* location = nullptr;
+    ObjHeader* initializerStackLocation = nullptr;
+    ObjHeader* waiterStackLocation = nullptr;
+    ObjHeader* waiterResult = nullptr;
+    std::atomic<bool> constructorStarted(false);
+
+    EXPECT_CALL(constructor(), Call(_)).WillOnce([this, &constructorStarted](ObjHeader*) {
+        constructorStarted = true;
+        // The waiting thread stops spinning and goes to sleep in the native state, so a GC wouldn't wait for it.
+        while (threadData(1).state() != ThreadState::kNative) {
+        }
+    });
+    std::thread waiter([this, &location, &waiterStackLocation, &waiterResult, &constructorStarted]() {
+        while (!constructorStarted) {
+        }
+        waiterResult = InitSingleton(&location, 1, &waiterStackLocation);
+    });
+    ObjHeader* value = InitSingleton(&location, 0, &initializerStackLocation);
+    waiter.join();
+    testing::Mock::VerifyAndClearExpectations(&constructor());
+
+    EXPECT_THAT(waiterResult, value);
+    EXPECT_THAT(waiterStackLocation, value);
+    EXPECT_THAT(threadData(1).state(), ThreadState::kRunnable);
+}
@@ -203,14 +203,18 @@ extern "C" OBJ_GETTER(ReadHeapRefNoLock, ObjHeader* object, int32_t index) {
     ThrowNotImplementedError();
 }
 
-extern "C" RUNTIME_NOTHROW void EnterFrame(ObjHeader** start, int parameters, int count) {
-    auto* threadData = mm::ThreadRegistry::Instance().CurrentThreadData();
-    threadData->shadowStack().EnterFrame(start, parameters, count);
+extern "C" OBJ_GETTER(InternString, ObjHeader* string) {
+    // TODO: Needs the GC to remove dying strings from an intern table.
+    //       Until then, interning fails instead of returning unequal instances for equal strings.
+    ThrowIllegalStateException();
 }
 
-extern "C" RUNTIME_NOTHROW void LeaveFrame(ObjHeader** start, int parameters, int count) {
-    auto* threadData = mm::ThreadRegistry::Instance().CurrentThreadData();
-    threadData->shadowStack().LeaveFrame(start, parameters, count);
+extern "C" ALWAYS_INLINE RUNTIME_NOTHROW void EnterFrame(ObjHeader** start, int parameters, int count) {
+    mm::ShadowStack::EnterCurrentFrame(start, parameters, count);
+}
+
+extern "C" ALWAYS_INLINE RUNTIME_NOTHROW void LeaveFrame(ObjHeader** start, int parameters, int count) {
+    mm::ShadowStack::LeaveCurrentFrame(start, parameters, count);
 }
 
 extern "C" RUNTIME_NOTHROW void AddTLSRecord(MemoryState* memory, void** key, int size) {
@@ -415,16 +419,19 @@ extern "C" void CheckGlobalsAccessible() {
 
 extern "C" RUNTIME_NOTHROW void Kotlin_mm_safePointFunctionEpilogue() {
     auto* threadData = mm::ThreadRegistry::Instance().CurrentThreadData();
+    threadData->SaveStackPosition();
     threadData->gc().SafePointFunctionEpilogue();
 }
 
 extern "C" RUNTIME_NOTHROW void Kotlin_mm_safePointWhileLoopBody() {
     auto* threadData = mm::ThreadRegistry::Instance().CurrentThreadData();
+    threadData->SaveStackPosition();
     threadData->gc().SafePointLoopBody();
 }
 
 extern "C" RUNTIME_NOTHROW void Kotlin_mm_safePointExceptionUnwind() {
     auto* threadData = mm::ThreadRegistry::Instance().CurrentThreadData();
+    threadData->SaveStackPosition();
     threadData->gc().SafePointExceptionUnwind();
 }
 
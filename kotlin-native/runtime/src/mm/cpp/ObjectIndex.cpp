@@ -0,0 +1,44 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ObjectIndex.hpp"
+
+#include <algorithm>
+
+#include "KAssert.h"
+#include "TypeInfo.h"
+
+using namespace kotlin;
+
+void mm::ObjectIndex::Add(ObjHeader* object) noexcept {
+    RuntimeAssert(!sealed_, "Cannot add objects to a sealed index");
+    const TypeInfo* typeInfo = object->type_info();
+    uintptr_t begin = reinterpret_cast<uintptr_t>(object);
+    uintptr_t size = typeInfo->IsArray()
+            ? sizeof(ArrayHeader) + static_cast<uintptr_t>(-typeInfo->instanceSize_) * object->array()->count_
+            : static_cast<uintptr_t>(typeInfo->instanceSize_);
+    ranges_.push_back({begin, begin + size});
+    lowest_ = std::min(lowest_, begin);
+    highest_ = std::max(highest_, begin + size);
+}
+
+void mm::ObjectIndex::Seal() noexcept {
+    std::sort(ranges_.begin(), ranges_.end(), [](const Range& lhs, const Range& rhs) { return lhs.begin < rhs.begin; });
+    sealed_ = true;
+}
+
+ObjHeader* mm::ObjectIndex::Find(const void* pointer) const noexcept {
+    RuntimeAssert(sealed_, "Index must be sealed before lookups");
+    auto address = reinterpret_cast<uintptr_t>(pointer);
+    // Most words on a stack are small integers or point into the stack itself.
+    if (address < lowest_ || address >= highest_) return nullptr;
+    auto it = std::upper_bound(ranges_.begin(), ranges_.end(), address, [](uintptr_t value, const Range& range) {
+        return value < range.begin;
+    });
+    if (it == ranges_.begin()) return nullptr;
+    --it;
+    if (address >= it->end) return nullptr;
+    return reinterpret_cast<ObjHeader*>(it->begin);
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_MM_OBJECT_INDEX_H
+#define RUNTIME_MM_OBJECT_INDEX_H
+
+#include <cstdint>
+
+#include "Memory.h"
+#include "Types.h"
+#include "Utils.hpp"
+
+namespace kotlin {
+namespace mm {
+
+// Address ranges of heap objects, for checking words found by `ConservativeStack`. Heap objects are allocated one by
+// one, so there are no heap pages to check a word against: the index is built from `ObjectFactory` while nobody
+// allocates or frees objects, e.g. when the world is stopped for a collection, and is valid until that changes.
+class ObjectIndex : private MoveOnly {
+public:
+    ObjectIndex() noexcept = default;
+    ObjectIndex(ObjectIndex&&) noexcept = default;
+    ObjectIndex& operator=(ObjectIndex&&) noexcept = default;
+
+    // `objects` is `ObjectFactory::Iterable`.
+    template <typename Iterable>
+    void AddAll(Iterable& objects) noexcept {
+        for (auto node : objects) {
+            Add(node.IsArray() ? node.GetArrayHeader()->obj() : node.GetObjHeader());
+        }
+    }
+
+    void Add(ObjHeader* object) noexcept;
+
+    // Must be called after the last `Add` and before the first `Find`.
+    void Seal() noexcept;
+
+    // The object `pointer` points to or into, or `nullptr` if it doesn't point into any object.
+    ObjHeader* Find(const void* pointer) const noexcept;
+
+    size_t size() const noexcept { return ranges_.size(); }
+
+private:
+    struct Range {
+        uintptr_t begin;
+        uintptr_t end;
+    };
+
+    KStdVector<Range> ranges_;
+    uintptr_t lowest_ = UINTPTR_MAX;
+    uintptr_t highest_ = 0;
+    bool sealed_ = false;
+};
+
+} // namespace mm
+} // namespace kotlin
+
+#endif // RUNTIME_MM_OBJECT_INDEX_H
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ObjectIndex.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "ObjectTestSupport.hpp"
+
+using namespace kotlin;
+
+namespace {
+
+struct Payload {
+    ObjHeader* field1;
+    ObjHeader* field2;
+
+    static constexpr std::array kFields{
+            &Payload::field1,
+            &Payload::field2,
+    };
+};
+
+template <typename T>
+const void* Offset(T& value, ptrdiff_t offset) {
+    return reinterpret_cast<const uint8_t*>(&value) + offset;
+}
+
+} // namespace
+
+TEST(ObjectIndexTest, Empty) {
+    mm::ObjectIndex index;
+    index.Seal();
+
+    EXPECT_THAT(index.size(), 0);
+    EXPECT_THAT(index.Find(nullptr), nullptr);
+    EXPECT_THAT(index.Find(&index), nullptr);
+}
+
+TEST(ObjectIndexTest, FindObjects) {
+    test_support::TypeInfoHolder type{test_support::TypeInfoHolder::ObjectBuilder<Payload>()};
+    test_support::Object<Payload> object1(type.typeInfo());
+    test_support::Object<Payload> object2(type.typeInfo());
+    test_support::ObjectArray<3> array;
+
+    mm::ObjectIndex index;
+    index.Add(object2.header());
+    index.Add(array.header());
+    index.Add(object1.header());
+    index.Seal();
+
+    EXPECT_THAT(index.size(), 3);
+    EXPECT_THAT(index.Find(object1.header()), object1.header());
+    EXPECT_THAT(index.Find(&object1->field2), object1.header());
+    EXPECT_THAT(index.Find(Offset(object1, sizeof(object1) - 1)), object1.header());
+    EXPECT_THAT(index.Find(object2.header()), object2.header());
+    EXPECT_THAT(index.Find(&array.elements()[2]), array.header());
+    EXPECT_THAT(index.Find(Offset(array, sizeof(array) - 1)), array.header());
+    EXPECT_THAT(index.Find(nullptr), nullptr);
+    EXPECT_THAT(index.Find(&index), nullptr);
+    EXPECT_THAT(index.Find(type.typeInfo()), nullptr);
+}
+
+TEST(ObjectIndexTest, PointersBetweenObjects) {
+    test_support::TypeInfoHolder type{test_support::TypeInfoHolder::ObjectBuilder<Payload>()};
+    std::array<test_support::Object<Payload>, 3> objects{
+            test_support::Object<Payload>(type.typeInfo()),
+            test_support::Object<Payload>(type.typeInfo()),
+            test_support::Object<Payload>(type.typeInfo()),
+    };
+
+    mm::ObjectIndex index;
+    index.Add(objects[0].header());
+    index.Add(objects[2].header());
+    index.Seal();
+
+    EXPECT_THAT(index.Find(objects[1].header()), nullptr);
+    EXPECT_THAT(index.Find(&objects[1]->field2), nullptr);
+    EXPECT_THAT(index.Find(Offset(objects[2], sizeof(objects[2]))), nullptr);
+    EXPECT_THAT(index.Find(Offset(objects[0], -1)), nullptr);
+}
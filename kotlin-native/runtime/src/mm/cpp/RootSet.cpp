@@ -11,8 +11,14 @@
 
 using namespace kotlin;
 
-mm::ThreadRootSet::Iterator::Iterator(begin_t, ThreadRootSet& owner) noexcept :
-    owner_(owner), phase_(Phase::kStack), stackIterator_(owner_.stack_.begin()) {
+mm::ThreadRootSet::Iterator::Iterator(begin_t, ThreadRootSet& owner) noexcept : owner_(owner) {
+    if (owner_.stack_) {
+        phase_ = Phase::kStack;
+        stackIterator_ = owner_.stack_->begin();
+    } else {
+        phase_ = Phase::kPinned;
+        pinnedIterator_ = owner_.pinned_.begin();
+    }
     Init();
 }
 
@@ -22,6 +28,8 @@ ObjHeader*& mm::ThreadRootSet::Iterator::operator*() noexcept {
     switch (phase_) {
         case Phase::kStack:
             return *stackIterator_;
+        case Phase::kPinned:
+            return *pinnedIterator_;
         case Phase::kTLS:
             return **tlsIterator_;
         case Phase::kDone:
@@ -35,6 +43,10 @@ mm::ThreadRootSet::Iterator& mm::ThreadRootSet::Iterator::operator++() noexcept
             ++stackIterator_;
             Init();
             return *this;
+        case Phase::kPinned:
+            ++pinnedIterator_;
+            Init();
+            return *this;
         case Phase::kTLS:
             ++tlsIterator_;
             Init();
@@ -54,6 +66,8 @@ bool mm::ThreadRootSet::Iterator::operator==(const Iterator& rhs) const noexcept
             return true;
         case Phase::kStack:
             return stackIterator_ == rhs.stackIterator_;
+        case Phase::kPinned:
+            return pinnedIterator_ == rhs.pinnedIterator_;
         case Phase::kTLS:
             return tlsIterator_ == rhs.tlsIterator_;
     }
@@ -63,7 +77,12 @@ void mm::ThreadRootSet::Iterator::Init() noexcept {
     while (phase_ != Phase::kDone) {
         switch (phase_) {
             case Phase::kStack:
-                if (stackIterator_ != owner_.stack_.end()) return;
+                if (stackIterator_ != owner_.stack_->end()) return;
+                phase_ = Phase::kTLS;
+                tlsIterator_ = owner_.tls_.begin();
+                break;
+            case Phase::kPinned:
+                if (pinnedIterator_ != owner_.pinned_.end()) return;
                 phase_ = Phase::kTLS;
                 tlsIterator_ = owner_.tls_.begin();
                 break;
@@ -143,7 +162,19 @@ void mm::GlobalRootSet::Iterator::Init() noexcept {
     }
 }
 
+mm::ThreadRootSet::ThreadRootSet(
+        const ConservativeStack& stack, const ObjectIndex& heap, ThreadLocalStorage& tls) noexcept : tls_(tls) {
+    for (void* word : stack) {
+        if (ObjHeader* object = heap.Find(word)) {
+            pinned_.push_back(object);
+        }
+    }
+}
+
 mm::ThreadRootSet::ThreadRootSet(ThreadData& threadData) noexcept : ThreadRootSet(threadData.shadowStack(), threadData.tls()) {}
 
+mm::ThreadRootSet::ThreadRootSet(ThreadData& threadData, const ObjectIndex& heap) noexcept :
+    ThreadRootSet(threadData.conservativeStack(), heap, threadData.tls()) {}
+
 mm::GlobalRootSet::GlobalRootSet() noexcept :
     GlobalRootSet(mm::GlobalData::Instance().globalsRegistry(), mm::GlobalData::Instance().stableRefRegistry()) {}
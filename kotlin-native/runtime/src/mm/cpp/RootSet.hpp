@@ -6,7 +6,9 @@
 #ifndef RUNTIME_MM_ROOT_SET_H
 #define RUNTIME_MM_ROOT_SET_H
 
+#include "ConservativeStack.hpp"
 #include "GlobalsRegistry.hpp"
+#include "ObjectIndex.hpp"
 #include "ShadowStack.hpp"
 #include "StableRefRegistry.hpp"
 #include "ThreadLocalStorage.hpp"
@@ -41,6 +43,7 @@ public:
     private:
         enum class Phase {
             kStack,
+            kPinned,
             kTLS,
             kDone,
         };
@@ -51,18 +54,25 @@ public:
         Phase phase_;
         union {
             ShadowStack::Iterator stackIterator_;
+            KStdVector<ObjHeader*>::iterator pinnedIterator_;
             ThreadLocalStorage::Iterator tlsIterator_;
         };
     };
 
-    ThreadRootSet(ShadowStack& stack, ThreadLocalStorage& tls) noexcept : stack_(stack), tls_(tls) {}
+    ThreadRootSet(ShadowStack& stack, ThreadLocalStorage& tls) noexcept : stack_(&stack), tls_(tls) {}
     explicit ThreadRootSet(ThreadData& threadData) noexcept;
 
+    // Finds stack roots by scanning `stack` conservatively. They are pinned: the GC may mark them, but must neither
+    // move them nor update references to them.
+    ThreadRootSet(const ConservativeStack& stack, const ObjectIndex& heap, ThreadLocalStorage& tls) noexcept;
+    ThreadRootSet(ThreadData& threadData, const ObjectIndex& heap) noexcept;
+
     Iterator begin() noexcept { return Iterator(Iterator::begin, *this); }
     Iterator end() noexcept { return Iterator(Iterator::end, *this); }
 
 private:
-    ShadowStack& stack_;
+    ShadowStack* stack_ = nullptr;
+    KStdVector<ObjHeader*> pinned_;
     ThreadLocalStorage& tls_;
 };
 
@@ -8,6 +8,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "ObjectTestSupport.hpp"
 #include "ShadowStack.hpp"
 
 using namespace kotlin;
@@ -46,6 +47,31 @@ private:
 
 struct TLSKey {};
 
+struct Payload {
+    ObjHeader* field1;
+    ObjHeader* field2;
+
+    static constexpr std::array kFields{
+            &Payload::field1,
+            &Payload::field2,
+    };
+};
+
+// Keeps `pointer` in this frame, which is above the saved stack position.
+NO_INLINE KStdVector<ObjHeader*> CollectConservatively(
+        mm::ConservativeStack& stack, const mm::ObjectIndex& heap, mm::ThreadLocalStorage& tls, void* pointer) {
+    void* volatile local = pointer;
+    stack.SavePosition();
+    mm::ThreadRootSet iter(stack, heap, tls);
+
+    KStdVector<ObjHeader*> actual;
+    for (auto& object : iter) {
+        actual.push_back(object);
+    }
+    EXPECT_THAT(local, pointer);
+    return actual;
+}
+
 } // namespace
 
 TEST(ThreadRootSetTest, Basic) {
@@ -81,6 +107,27 @@ TEST(ThreadRootSetTest, Empty) {
     EXPECT_THAT(actual, testing::IsEmpty());
 }
 
+TEST(ThreadRootSetTest, ConservativeStack) {
+    test_support::TypeInfoHolder type{test_support::TypeInfoHolder::ObjectBuilder<Payload>()};
+    test_support::Object<Payload> object(type.typeInfo());
+    mm::ObjectIndex heap;
+    heap.Add(object.header());
+    heap.Seal();
+
+    TLSKey key;
+    mm::ThreadLocalStorage tls;
+    tls.AddRecord(&key, 1);
+    tls.Commit();
+    mm::ConservativeStack stack;
+
+    // An interior pointer pins the whole object.
+    auto actual = CollectConservatively(stack, heap, tls, &object->field2);
+
+    ASSERT_THAT(actual.size(), testing::Ge(2));
+    EXPECT_THAT(KStdVector<ObjHeader*>(actual.begin(), actual.end() - 1), testing::Each(object.header()));
+    EXPECT_THAT(actual.back(), *tls.Lookup(&key, 0));
+}
+
 TEST(GlobalRootSetTest, Basic) {
     mm::GlobalsRegistry globals;
     mm::GlobalsRegistry::ThreadQueue globalsProducer(globals);
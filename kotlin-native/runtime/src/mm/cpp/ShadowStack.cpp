@@ -7,6 +7,8 @@
 
 using namespace kotlin;
 
+THREAD_LOCAL_VARIABLE FrameOverlay* mm::internal::currentFrame TLS_INITIAL_EXEC = nullptr;
+
 mm::ShadowStack::Iterator& mm::ShadowStack::Iterator::operator++() noexcept {
     ++object_;
     Init();
@@ -21,17 +23,3 @@ void mm::ShadowStack::Iterator::Init() noexcept {
         end_ = end();
     }
 }
-
-void mm::ShadowStack::EnterFrame(ObjHeader** start, int parameters, int count) noexcept {
-    FrameOverlay* frame = reinterpret_cast<FrameOverlay*>(start);
-    frame->previous = currentFrame_;
-    currentFrame_ = frame;
-    // TODO: maybe compress in single value somehow.
-    frame->parameters = parameters;
-    frame->count = count;
-}
-
-void mm::ShadowStack::LeaveFrame(ObjHeader** start, int parameters, int count) noexcept {
-    FrameOverlay* frame = reinterpret_cast<FrameOverlay*>(start);
-    currentFrame_ = frame->previous;
-}
@@ -6,6 +6,7 @@
 #ifndef RUNTIME_MM_SHADOW_STACK
 #define RUNTIME_MM_SHADOW_STACK
 
+#include "Common.h"
 #include "Memory.h"
 #include "Utils.hpp"
 
@@ -15,6 +16,14 @@ struct ObjHeader;
 namespace kotlin {
 namespace mm {
 
+namespace internal {
+
+// Top of the current thread's shadow stack. It's a separate thread local rather than a field of `ThreadData`, so that
+// `EnterFrame` and `LeaveFrame` called in every function prologue and epilogue don't have to look up `ThreadData`.
+extern THREAD_LOCAL_VARIABLE FrameOverlay* currentFrame TLS_INITIAL_EXEC;
+
+} // namespace internal
+
 // Accessing current stack as provided by K/N compiler. The compiler calls `EnterFrame` when
 // it has allocated and zeroed stack space in the function prologue. And it calls `LeaveFrame` in
 // the function epilogue (both for regular return and for exception unwinding).
@@ -23,6 +32,8 @@ namespace mm {
 // running code outside Kotlin), or by the mutator itself. So, in concurrent collection case, make sure
 // to do as little as possible while scanning the stack to free the mutator as soon as possible.
 //
+// `ShadowStack` is a view of the stack of the thread that constructed it, so that other threads can scan it too.
+//
 // TODO: This is currently incompatible with stack-allocated objects. Fix it.
 class ShadowStack : private Pinned {
 public:
@@ -51,14 +62,46 @@ public:
         ObjHeader** end_ = nullptr;
     };
 
-    void EnterFrame(ObjHeader** start, int parameters, int count) noexcept;
-    void LeaveFrame(ObjHeader** start, int parameters, int count) noexcept;
+    ShadowStack() noexcept : currentFrame_(&internal::currentFrame) {}
+
+    // Work with the current thread's stack directly, without going through `ShadowStack` of its `ThreadData`.
+    static ALWAYS_INLINE void EnterCurrentFrame(ObjHeader** start, int parameters, int count) noexcept {
+        EnterFrame(internal::currentFrame, start, parameters, count);
+    }
 
-    Iterator begin() noexcept { return Iterator(currentFrame_); }
+    static ALWAYS_INLINE void LeaveCurrentFrame(ObjHeader** start, int parameters, int count) noexcept {
+        LeaveFrame(internal::currentFrame, start, parameters, count);
+    }
+
+    void EnterFrame(ObjHeader** start, int parameters, int count) noexcept {
+        EnterFrame(*currentFrame_, start, parameters, count);
+    }
+
+    void LeaveFrame(ObjHeader** start, int parameters, int count) noexcept {
+        LeaveFrame(*currentFrame_, start, parameters, count);
+    }
+
+    Iterator begin() noexcept { return Iterator(*currentFrame_); }
     Iterator end() noexcept { return Iterator(nullptr); }
 
 private:
-    FrameOverlay* currentFrame_ = nullptr;
+    static ALWAYS_INLINE void EnterFrame(
+            FrameOverlay*& currentFrame, ObjHeader** start, int parameters, int count) noexcept {
+        FrameOverlay* frame = reinterpret_cast<FrameOverlay*>(start);
+        frame->previous = currentFrame;
+        currentFrame = frame;
+        // TODO: maybe compress in single value somehow.
+        frame->parameters = parameters;
+        frame->count = count;
+    }
+
+    static ALWAYS_INLINE void LeaveFrame(
+            FrameOverlay*& currentFrame, ObjHeader** start, int parameters, int count) noexcept {
+        FrameOverlay* frame = reinterpret_cast<FrameOverlay*>(start);
+        currentFrame = frame->previous;
+    }
+
+    FrameOverlay** const currentFrame_;
 };
 
 } // namespace mm
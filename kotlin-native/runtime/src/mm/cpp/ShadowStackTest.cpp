@@ -5,6 +5,8 @@
 
 #include "ShadowStack.hpp"
 
+#include <thread>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -119,3 +121,27 @@ TEST(ShadowStackTest, ManyStackFrames) {
 
     EXPECT_THAT(actual, testing::ElementsAre(frame4[0], frame4[1], frame4[2], frame3[0], frame1[0], frame1[1], frame1[2]));
 }
+
+TEST(ShadowStackTest, CurrentThreadFrames) {
+    mm::ShadowStack shadowStack;
+    StackEntry<1, 3> frame1(shadowStack);
+
+    constexpr int kFrameOverlayCount = sizeof(FrameOverlay) / sizeof(ObjHeader**);
+    std::array<ObjHeader*, kFrameOverlayCount + 1> data;
+    ObjHeader object;
+    data[kFrameOverlayCount] = &object;
+    mm::ShadowStack::EnterCurrentFrame(data.data(), 0, data.size());
+
+    KStdVector<ObjHeader*> otherThreadActual;
+    std::thread([&otherThreadActual] {
+        mm::ShadowStack otherThreadShadowStack;
+        otherThreadActual = Collect(otherThreadShadowStack);
+    }).join();
+    auto actual = Collect(shadowStack);
+
+    mm::ShadowStack::LeaveCurrentFrame(data.data(), 0, data.size());
+
+    EXPECT_THAT(actual, testing::ElementsAre(&object, frame1[0], frame1[1], frame1[2]));
+    EXPECT_THAT(otherThreadActual, testing::IsEmpty());
+    EXPECT_THAT(Collect(shadowStack), testing::ElementsAre(frame1[0], frame1[1], frame1[2]));
+}
@@ -7,12 +7,15 @@
 #define RUNTIME_MM_THREAD_DATA_H
 
 #include <atomic>
+#include <optional>
 #include <pthread.h>
 
 #include "GlobalData.hpp"
 #include "GlobalsRegistry.hpp"
 #include "GC.hpp"
+#include "KAssert.h"
 #include "ObjectFactory.hpp"
+#include "ConservativeStack.hpp"
 #include "ShadowStack.hpp"
 #include "StableRefRegistry.hpp"
 #include "ThreadLocalStorage.hpp"
@@ -35,7 +38,12 @@ public:
         stableRefThreadQueue_(StableRefRegistry::Instance()),
         state_(ThreadState::kRunnable),
         gc_(GlobalData::Instance().gc()),
-        objectFactoryThreadQueue_(GlobalData::Instance().objectFactory(), gc_) {}
+        objectFactoryThreadQueue_(GlobalData::Instance().objectFactory(), gc_) {
+        // Finding the stack bottom may be a syscall, and without conservative scanning it's not needed.
+        if (ConservativeStack::IsEnabled()) {
+            conservativeStack_.emplace();
+        }
+    }
 
     ~ThreadData() = default;
 
@@ -55,6 +63,19 @@ public:
 
     ShadowStack& shadowStack() noexcept { return shadowStack_; }
 
+    // Only exists when `ConservativeStack::IsEnabled()`.
+    ConservativeStack& conservativeStack() noexcept {
+        RuntimeAssert(conservativeStack_.has_value(), "Conservative stack scanning is disabled");
+        return *conservativeStack_;
+    }
+
+    // Lets other threads scan the stack conservatively while this thread is in native code or parked at a safe point.
+    void SaveStackPosition() noexcept {
+        if (conservativeStack_) {
+            conservativeStack_->SavePosition();
+        }
+    }
+
     KStdVector<std::pair<ObjHeader**, ObjHeader*>>& initializingSingletons() noexcept { return initializingSingletons_; }
 
     GC::ThreadData& gc() noexcept { return gc_; }
@@ -79,6 +100,7 @@ private:
     StableRefRegistry::ThreadQueue stableRefThreadQueue_;
     std::atomic<ThreadState> state_;
     ShadowStack shadowStack_;
+    std::optional<ConservativeStack> conservativeStack_;
     GC::ThreadData gc_;
     ObjectFactory<GC>::ThreadQueue objectFactoryThreadQueue_;
     KStdVector<std::pair<ObjHeader**, ObjHeader*>> initializingSingletons_;
@@ -26,6 +26,10 @@ const char* stateToString(ThreadState state) noexcept {
 
 // Switches the state of the current thread to `newState` and returns the previous state.
 ALWAYS_INLINE ThreadState kotlin::SwitchThreadState(mm::ThreadData* threadData, ThreadState newState) noexcept {
+    // Leaving Kotlin code lets other threads scan the stack.
+    if (newState == ThreadState::kNative) {
+        threadData->SaveStackPosition();
+    }
     auto oldState = threadData->setState(newState);
     // TODO(perf): Mesaure the impact of this assert in debug and opt modes.
     RuntimeAssert(isStateSwitchAllowed(oldState, newState),
@@ -0,0 +1,223 @@
+#!/usr/bin/env python3
+#
+# Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+# that can be found in the LICENSE file.
+#
+
+"""
+Generates runtime/src/main/cpp/CharPropertiesTables.h, the two-stage table of Char properties behind the runtime
+Char classification intrinsics. The properties are taken from the Kotlin tables generated by GenerateUnicodeData.kt
+in runtime/src/main/kotlin/generated, and digit values from the ranges Kotlin_Char_digitOfChecked always accepted,
+so the intrinsics agree with them on every Char.
+
+Usage: generate_char_tables.py [<kotlin-native root>]
+"""
+
+import os
+import re
+import sys
+
+BLOCK_SIZE = 64
+
+# Values of kotlin.text.CharCategory.
+UNASSIGNED = 0
+UPPERCASE_LETTER = 1
+LOWERCASE_LETTER = 2
+OTHER_LETTER = 5
+DECIMAL_DIGIT_NUMBER = 9
+
+
+def read_arrays(path):
+    with open(path) as file:
+        text = file.read()
+    arrays = {}
+    for name, body in re.findall(r'private val (\w+) = intArrayOf\((.*?)\)', text, re.S):
+        arrays[name] = [int(value, 0) for value in re.findall(r'-?0x[0-9a-fA-F]+|-?\d+', body)]
+    return arrays
+
+
+def binary_search_range(array, needle):
+    bottom, top, middle, value = 0, len(array) - 1, -1, 0
+    while bottom <= top:
+        middle = (bottom + top) // 2
+        value = array[middle]
+        if needle > value:
+            bottom = middle + 1
+        elif needle == value:
+            return middle
+        else:
+            top = middle - 1
+    return middle - (1 if needle < value else 0)
+
+
+def category_value(tables, ch):
+    starts, codes = tables['rangeStart'], tables['rangeCategory']
+    index = binary_search_range(starts, ch)
+    code, distance = codes[index], ch - starts[index]
+    if code < 0x20:
+        value = code
+    elif code < 0x400:
+        value = code >> 5 if distance & 1 == 1 else code & 0x1f
+    else:
+        value = [code & 0x1f, (code >> 5) & 0x1f, code >> 10][distance % 3]
+    # 17 encodes unassigned chars in the Kotlin table.
+    return UNASSIGNED if value == 17 else value
+
+
+def letter_type(tables, ch):
+    starts, lengths, codes = tables['rangeStart'], tables['rangeLength'], tables['rangeCategory']
+    index = binary_search_range(starts, ch)
+    if index < 0:
+        return 0
+    start, code = starts[index], codes[index]
+    if ch > start + lengths[index] - 1:
+        return 0
+    last_two_bits = code & 0x3
+    if last_two_bits == 0:
+        shift, threshold = 2, start
+        for _ in range(2):
+            threshold += (code >> shift) & 0x7f
+            if threshold > ch:
+                return 3
+            shift += 7
+            threshold += (code >> shift) & 0x7f
+            if threshold > ch:
+                return 0
+            shift += 7
+        return 3
+    if code <= 0x7:
+        return last_two_bits
+    distance = ch - start
+    shift = distance % 2 if code <= 0x1f else distance
+    return (code >> (2 * shift)) & 0x3
+
+
+def is_digit(tables, ch):
+    index = binary_search_range(tables['rangeStart'], ch)
+    return index >= 0 and ch <= tables['rangeStart'][index] + 9
+
+
+def is_whitespace(ch):
+    return (0x9 <= ch <= 0xd or 0x1c <= ch <= 0x20 or ch == 0xa0 or ch == 0x1680 or 0x2000 <= ch <= 0x200a or
+            ch in (0x2028, 0x2029, 0x202f, 0x205f, 0x3000))
+
+
+def equal_distance_mapping(code, start, pattern):
+    diff = code - start
+    if diff >= pattern & 0xff:
+        return code
+    if diff % ((pattern >> 8) & 0xf) != 0:
+        return code
+    return code + (pattern >> 12)
+
+
+def case_mapping(tables, ch):
+    index = binary_search_range(tables['rangeStart'], ch)
+    if index < 0:
+        return ch
+    return equal_distance_mapping(ch, tables['rangeStart'][index], tables['rangeLength'][index])
+
+
+def titlecase(uppercase, ch):
+    if 0x01c4 <= ch <= 0x01cc or 0x01f1 <= ch <= 0x01f3:
+        return 3 * ((ch + 1) // 3)
+    if 0x10d0 <= ch <= 0x10fa or 0x10fd <= ch <= 0x10ff:
+        return ch
+    return uppercase
+
+
+# Ranges of Kotlin_Char_digitOfChecked, as [first, last, value of first].
+LEGACY_DIGIT_RANGES = [
+    (0x30, 0x39, 0), (0x41, 0x5a, 10), (0x61, 0x7a, 10), (0x660, 0x669, 0), (0x6f0, 0x6f9, 0), (0x966, 0x96f, 0),
+    (0x9e6, 0x9ef, 0), (0xa66, 0xa6f, 0), (0xae6, 0xaef, 0), (0xb66, 0xb6f, 0), (0xbe7, 0xbef, 1), (0xc66, 0xc6f, 0),
+    (0xce6, 0xcef, 0), (0xd66, 0xd6f, 0), (0xe50, 0xe59, 0), (0xed0, 0xed9, 0), (0xf20, 0xf29, 0), (0x1040, 0x1049, 0),
+    (0x1369, 0x1371, 1), (0x17e0, 0x17e9, 0), (0x1810, 0x1819, 0), (0xff10, 0xff19, 0), (0xff21, 0xff3a, 10),
+    (0xff41, 0xff5a, 10),
+]
+
+
+def digit_value(ch):
+    for first, last, value in LEGACY_DIGIT_RANGES:
+        if first <= ch <= last:
+            return value + ch - first
+    return -1
+
+
+def format_rows(values, per_row, indent):
+    return ''.join(indent + ' '.join('%d,' % value for value in values[i:i + per_row]) + '\n'
+                   for i in range(0, len(values), per_row))
+
+
+def main():
+    root = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), '..', '..')
+    generated = os.path.join(root, 'runtime', 'src', 'main', 'kotlin', 'generated')
+    categories = read_arrays(os.path.join(generated, '_CharCategories.kt'))
+    letters = read_arrays(os.path.join(generated, '_LetterChars.kt'))
+    digits = read_arrays(os.path.join(generated, '_DigitChars.kt'))
+    lowercase = read_arrays(os.path.join(generated, '_LowercaseMappings.kt'))
+    uppercase = read_arrays(os.path.join(generated, '_UppercaseMappings.kt'))
+
+    records, record_indices, chars = [], {}, []
+    for ch in range(0x10000):
+        category = category_value(categories, ch)
+        # The runtime derives letter, case and digit checks from the category.
+        letter = letter_type(letters, ch)
+        expected_letter = {UPPERCASE_LETTER: 2, LOWERCASE_LETTER: 1}.get(
+            category, 3 if UPPERCASE_LETTER <= category <= OTHER_LETTER else 0)
+        assert letter == expected_letter, 'Letter table disagrees with categories at 0x%04x' % ch
+        assert is_digit(digits, ch) == (category == DECIMAL_DIGIT_NUMBER), \
+            'Digit table disagrees with categories at 0x%04x' % ch
+
+        upper = case_mapping(uppercase, ch)
+        record = (category, int(is_whitespace(ch)), digit_value(ch),
+                  case_mapping(lowercase, ch) - ch, upper - ch, titlecase(upper, ch) - ch)
+        if record not in record_indices:
+            record_indices[record] = len(records)
+            records.append(record)
+        chars.append(record_indices[record])
+
+    blocks, block_indices, stage1 = [], {}, []
+    for start in range(0, 0x10000, BLOCK_SIZE):
+        block = tuple(chars[start:start + BLOCK_SIZE])
+        if block not in block_indices:
+            block_indices[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_indices[block])
+    assert len(blocks) <= 0x100, 'Block indices must fit into uint8_t'
+    assert len(records) <= 0x10000, 'Record indices must fit into uint16_t'
+
+    out = ['/*\n'
+           ' * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license\n'
+           ' * that can be found in the LICENSE file.\n'
+           ' */\n\n'
+           '//\n'
+           '// NOTE: THIS FILE IS AUTO-GENERATED by tools/scripts/generate_char_tables.py\n'
+           '//\n\n'
+           '#ifndef RUNTIME_CHAR_PROPERTIES_TABLES_H\n'
+           '#define RUNTIME_CHAR_PROPERTIES_TABLES_H\n\n'
+           '#include <cstdint>\n\n'
+           'namespace kotlin {\n'
+           'namespace internal {\n\n'
+           'constexpr uint32_t kCharBlockShift = %d;\n\n' % (BLOCK_SIZE.bit_length() - 1)]
+    out.append('// {category, whitespace, digit, lowercase delta, uppercase delta, titlecase delta}.\n')
+    out.append('constexpr CharProperties kCharProperties[] = {\n')
+    for record in records:
+        out.append('    {%d, %d, %d, %d, %d, %d},\n' % record)
+    out.append('};\n\n')
+    out.append('constexpr uint8_t kCharBlockIndices[] = {\n')
+    out.append(format_rows(stage1, 32, '    '))
+    out.append('};\n\n')
+    out.append('constexpr uint16_t kCharBlocks[][%d] = {\n' % BLOCK_SIZE)
+    for block in blocks:
+        out.append('    {\n' + format_rows(block, 32, '        ') + '    },\n')
+    out.append('};\n\n'
+               '} // namespace internal\n'
+               '} // namespace kotlin\n\n'
+               '#endif // RUNTIME_CHAR_PROPERTIES_TABLES_H\n')
+
+    with open(os.path.join(root, 'runtime', 'src', 'main', 'cpp', 'CharPropertiesTables.h'), 'w') as file:
+        file.write(''.join(out))
+
+
+if __name__ == '__main__':
+    main()
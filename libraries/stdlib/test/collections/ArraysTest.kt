@@ -544,6 +544,30 @@ class ArraysTest {
         expect(-1) { booleanArrayOf(true).indexOf(false) }
     }
 
+    @Test fun indexOfInLongPrimitiveArrays() {
+        for (size in listOf(15, 16, 17, 63, 64, 65, 200)) {
+            for (position in listOf(0, 1, size / 2, size - 2, size - 1)) {
+                val bytes = ByteArray(size).apply { this[position] = 1 }
+                val chars = CharArray(size).apply { this[position] = 'a' }
+                val ints = IntArray(size).apply { this[position] = 1 }
+                val longs = LongArray(size).apply { this[position] = 1 }
+                for ((index, lastIndex) in listOf(
+                    bytes.indexOf(1) to bytes.lastIndexOf(1),
+                    chars.indexOf('a') to chars.lastIndexOf('a'),
+                    ints.indexOf(1) to ints.lastIndexOf(1),
+                    longs.indexOf(1) to longs.lastIndexOf(1)
+                )) {
+                    assertEquals(position, index, "indexOf, size: $size")
+                    assertEquals(position, lastIndex, "lastIndexOf, size: $size")
+                }
+                assertEquals(if (position == 0) 1 else 0, ints.indexOf(0))
+                assertEquals(if (position == size - 1) size - 2 else size - 1, ints.lastIndexOf(0))
+                assertEquals(-1, longs.indexOf(2))
+                assertEquals(-1, longs.lastIndexOf(2))
+            }
+        }
+    }
+
     @Test fun indexOf() {
         expect(-1) { arrayOf("cat", "dog", "bird").indexOf("mouse") }
         expect(0) { arrayOf("cat", "dog", "bird").indexOf("cat") }
@@ -171,6 +171,18 @@ object ArrayOps : TemplateGroupBase() {
                 return true
                 """
             }
+            // Floating point values have several NaN representations, so they can't be compared bitwise.
+            if (primitive != null && !primitive.isFloatingPoint()) {
+                on(Backend.IR) {
+                    body {
+                        """
+                        if (this === other) return true
+                        if (this === null || other === null) return false
+                        return arrayContentEquals(this, other)
+                        """
+                    }
+                }
+            }
         }
     }
 
@@ -426,6 +438,16 @@ object ArrayOps : TemplateGroupBase() {
                 return result
                 """
             }
+            if (primitive != null) {
+                on(Backend.IR) {
+                    body {
+                        """
+                        if (this === null) return 0
+                        return arrayContentHashCode(this)
+                        """
+                    }
+                }
+            }
         }
     }
 